@@ -1 +1,4 @@
-extern const char area[30][32];
+#include "grid.h"
+
+/* The map the solvers search: GRID_SIZE_Y rows of GRID_SIZE_X tiles */
+extern const char area[GRID_SIZE_Y][GRID_SIZE_X];
@@ -24,142 +24,408 @@ Under the following terms:
 ============================================================
 */
 #include "astar.h"
-#include "area.h"
+#include "grid.h"
+#include "landmarks.h"
+#include "swamp.h"
+#include "vis.h"
 #include <string.h>
 
-#define ONE                       (byte)1
-#define BIT_ON(v, n)              (v |= (ONE << (n)))
-#define BIT_OFF(v, n)             (v &= (byte)~(ONE << (n)))
-#define BIT_VALUE(v, n)           (((v) >> (n)) & ONE)
-#define BIT_ARRAY_SET(a, i)       BIT_ON(    (a)[(i) / 8], ((i) % 8) )
-#define BIT_ARRAY_UNSET(a, i)     BIT_OFF(   (a)[(i) / 8], ((i) % 8) )
-#define BIT_ARRAY_VALUE(a, i)     BIT_VALUE( (a)[(i) / 8], ((i) % 8) )
+#define CLOSED_BYTES    ((GRID_CELLS + 7) / 8)
+#define MAX_OPEN_SET    ASTAR_OPEN_SIZE  /* Binary heap, root at 1, byte indices */
+#define MAX_HEURISTIC   ((GRID_SIZE_X - 1) + (GRID_SIZE_Y - 1))
 
-#define SIZE_X 32
-#define SIZE_Y 30
+/*
+  With a tie-break, the heap key is (f << TIE_BITS) | tie, tie being
+  saturated to TIE_MAX. f stays below 2048: g < GRID_CELLS and the
+  weighted h is at most 254 * 4 (landmark bounds fit in a byte).
+  With GRID_DIAGONAL, steps cost up to 3 and h is at most 91 * 4
+  (no landmarks), so f stays below 4096: the tie gets a bit less.
+*/
+#ifdef GRID_DIAGONAL
+#define TIE_BITS        4
+#else
+#define TIE_BITS        5
+#endif
+#define TIE_MAX         ((1 << TIE_BITS) - 1)
+
+/* Dropped open set entries: none */
+#define FORGOT_NONE     0xFFFF
+#define COST_NONE       0xFFFF
+
+/* g of a cell not reached yet (all bits set) */
+#ifdef ASTAR_COMPACT
+#define G_NONE          0x03FF
+#else
+#define G_NONE          COST_NONE
+#endif
 
-#define CELL_COUNT      (SIZE_X * SIZE_Y)
-#define CLOSED_BYTES    ((CELL_COUNT + 7) / 8)
-#define MAX_OPEN_SET    256  /* Limit for NES memory constraints */
+/* Cells per packed byte of 2-bit fields (ASTAR_COMPACT) */
+#define PACKED_BYTES    (GRID_CELLS / 4)
+
+#if ASTAR_OPEN_SIZE > 255 || ASTAR_OPEN_SIZE < 4
+#error "ASTAR_OPEN_SIZE must be in [4..255]"
+#endif
 
 typedef uint8_t bit8_t;
+
+/* Weighted h table entries: a byte, unless the widest grids need more */
+#if MAX_HEURISTIC * ASTAR_WEIGHT_MAX / 4 > 255
+typedef uint16_t weight_t;
+#else
+typedef uint8_t weight_t;
+#endif
 typedef uint16_t cost_t;
 
-/* Node structure for A* */
-typedef struct {
-  uint16_t index;      /* Cell index */
-  uint16_t parent;     /* Parent cell index */
-  cost_t   g;          /* Cost from start */
-  cost_t   f;          /* f = g + h */
-} Node;
-
-/* Memory layout - using external RAM at 0x6000+ */
-#define open_set      (*(Node (*)[MAX_OPEN_SET])(0x6000))
-#define g_score       (*(cost_t (*)[CELL_COUNT])(0x7000))
-#define parent_map    (*(uint16_t (*)[CELL_COUNT])(0x7800))
-
-/* Static variables */
-static uint16_t  open_count;
-static bit8_t    closed_set[CLOSED_BYTES];
-static uint16_t  index;
-static uint16_t  current_index;
-static uint16_t  neighbor_index;
-static uint16_t  destIndex;
-static uint16_t  i, j;
-static uint8_t   x, y;
-static uint8_t   nx, ny;
-static uint8_t   destX, destY;
-static cost_t    tentative_g;
-static cost_t    h_score;
-static cost_t    new_f;
-static int16_t   num_nodes;
-static uint16_t  trace_index;
-
-/* Direction offsets: right, left, down, up */
-static const int8_t dir_dx[4] = {1, -1, 0, 0};
-static const int8_t dir_dy[4] = {0, 0, 1, -1};
+/*
+  Memory layout - using external RAM at 0x6000+ (see wram.h)
+
+  Every 16-bit table is split into a low and a high byte table, so
+  that the 6502 reaches both halves with one index register or one
+  pointer whose high byte is bumped by a page offset.
+
+  The open set is a binary heap of (cell, f) pairs. Nodes are never
+  updated in place: a better path pushes a new entry, and stale
+  entries are skipped when popped because their cell is closed.
+
+  With ASTAR_COMPACT, g keeps its low byte table and its top two
+  bits go four cells per byte in g_top (g < GRID_CELLS fits in 10
+  bits). The parent of a cell is the direction of the step into
+  it, in parent_dir: the path is traced back by undoing steps.
+*/
+/* Closed set */
+static SOLVER_LOCAL bit8_t    astar_closed[CLOSED_BYTES];
+
+/* Kernel state */
+static SOLVER_LOCAL uint16_t  astar_node;  /* Cell to push / expand        */
+static SOLVER_LOCAL uint16_t  astar_key;   /* Its f score                  */
+static SOLVER_LOCAL cost_t    astar_g;     /* g of the expanded neighbors  */
+static SOLVER_LOCAL uint8_t   astar_count; /* Heap entries                 */
+static SOLVER_LOCAL uint8_t   astar_nb_count;
+static SOLVER_LOCAL uint8_t   astar_nb_lo[ASTAR_DIRS];
+static SOLVER_LOCAL uint8_t   astar_nb_hi[ASTAR_DIRS];
+static SOLVER_LOCAL uint8_t   astar_nb_x[ASTAR_DIRS];
+static SOLVER_LOCAL uint8_t   astar_nb_y[ASTAR_DIRS];
+#ifdef GRID_DIAGONAL
+static SOLVER_LOCAL cost_t    astar_nb_g[ASTAR_DIRS];  /* Steps differ */
+static SOLVER_LOCAL cost_t    g_here;
+#endif
+
+/* Static variables, hot ones in the zero page */
+#pragma bss-name (push, "ZEROPAGE")
+static SOLVER_LOCAL uint16_t  current_index;
+static SOLVER_LOCAL uint16_t  neighbor_index;
+static SOLVER_LOCAL uint8_t   x, y;
+static SOLVER_LOCAL uint8_t   nx, ny;
+static SOLVER_LOCAL uint8_t   destX, destY;
+static SOLVER_LOCAL uint8_t   n;
+#pragma bss-name (pop)
+
+static SOLVER_LOCAL uint16_t  index;
+static SOLVER_LOCAL uint16_t  destIndex;
+static SOLVER_LOCAL uint16_t  i, j;
+static SOLVER_LOCAL cost_t    h_score;
+static SOLVER_LOCAL int16_t   num_nodes;
+static SOLVER_LOCAL uint16_t  trace_index;
+
+/* Search mode (see astar_set_mode) */
+static uint8_t   weight = ASTAR_WEIGHT_ONE;
+static uint8_t   tie = ASTAR_TIE_FIRST;
+static weight_t  weighted_h[MAX_HEURISTIC + 1];
+static SOLVER_LOCAL int8_t    line_dx, line_dy;
+static SOLVER_LOCAL int16_t   cross;
+
+/* Landmark tables (see astar_set_landmarks) */
+static const uint8_t* landmark[ASTAR_MAX_LANDMARKS];
+static uint8_t   landmarks;
+static SOLVER_LOCAL uint8_t live_landmarks; /* landmarks, 0 off the area */
+static SOLVER_LOCAL uint8_t   goal_dist[ASTAR_MAX_LANDMARKS];
+static SOLVER_LOCAL uint8_t   l, d;
+
+/* Open set overflow: smallest key dropped since the last rebuild */
+static SOLVER_LOCAL uint16_t  forgot_key;
+static SOLVER_LOCAL uint16_t  worst_key;
+static SOLVER_LOCAL uint8_t   hole, child;
+
+SOLVER_LOCAL uint8_t          astar_status;
+SOLVER_LOCAL uint16_t         astar_expanded;
 
 #define IS_SOLID(x_, y_) ( \
-  area[(y_)][(x_)] != ' ' \
+  GRID_SOLID(x_, y_) \
 )
 
 #define IN_CLOSED(i_) ( \
-  BIT_ARRAY_VALUE(closed_set, (i_)) \
+  astar_closed[GRID_CELL_BYTE(i_)] & GRID_CELL_BIT(i_) \
 )
 
 #define ADD_TO_CLOSED(i_) ( \
-  BIT_ARRAY_SET(closed_set, (i_)) \
+  astar_closed[GRID_CELL_BYTE(i_)] |= GRID_CELL_BIT(i_) \
+)
+
+#define IN_BOUNDS_X(x_) ((x_) < GRID_SIZE_X)
+#define IN_BOUNDS_Y(y_) ((y_) < GRID_SIZE_Y)
+
+#define HEAP_KEY(n_) ( \
+  (cost_t)(heap_key_lo[(n_)] | (heap_key_hi[(n_)] << 8)) \
+)
+
+#define HEAP_MOVE(to_, from_) ( \
+  heap_node_lo[(to_)] = heap_node_lo[(from_)], \
+  heap_node_hi[(to_)] = heap_node_hi[(from_)], \
+  heap_key_lo[(to_)]  = heap_key_lo[(from_)],  \
+  heap_key_hi[(to_)]  = heap_key_hi[(from_)]   \
+)
+
+#ifdef ASTAR_COMPACT
+
+#define G_SCORE(i_) ( \
+  (cost_t)(g_lo[(i_)] | (GRID_SLOT_AT(g_top, i_) << 8)) \
+)
+
+#define SET_G(i_, g_) ( \
+  g_lo[(i_)] = (uint8_t)(g_), \
+  GRID_SET_SLOT(g_top, i_, (uint8_t)((g_) >> 8)) \
+)
+
+/* Cell i_ is reached from cell from_ by a step in direction dir_ */
+#define SET_PARENT(i_, from_, dir_) ( \
+  GRID_SET_SLOT(parent_dir, i_, dir_) \
+)
+
+#define PARENT_OF(i_) ( \
+  (i_) - grid_step[GRID_SLOT_AT(parent_dir, i_)] \
 )
 
-#define IN_BOUNDS_X(x_) ((x_) < SIZE_X)
-#define IN_BOUNDS_Y(y_) ((y_) < SIZE_Y)
+#else
+
+#define G_SCORE(i_) ( \
+  (cost_t)(g_lo[(i_)] | (g_hi[(i_)] << 8)) \
+)
+
+#define SET_G(i_, g_) ( \
+  g_lo[(i_)] = (uint8_t)(g_), \
+  g_hi[(i_)] = (uint8_t)((g_) >> 8) \
+)
+
+/* Cell i_ is reached from cell from_ by a step in direction dir_ */
+#define SET_PARENT(i_, from_, dir_) ( \
+  parent_lo[(i_)] = (uint8_t)(from_), \
+  parent_hi[(i_)] = (uint8_t)((from_) >> 8) \
+)
 
+#define PARENT_OF(i_) ( \
+  parent_lo[(i_)] | (parent_hi[(i_)] << 8) \
+)
+
+#endif
+
+#ifdef GRID_DIAGONAL
+/* Octile distance heuristic: diagonal steps (3), then straight ones (2) */
+static cost_t heuristic(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2) {
+  x1 = ABS_DIFF(x1, x2);
+  y1 = ABS_DIFF(y1, y2);
+  return x1 > y1 ? (cost_t)((x1 << 1) + y1) : (cost_t)((y1 << 1) + x1);
+}
+#else
 /* Manhattan distance heuristic */
 static cost_t heuristic(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2) {
   return (cost_t)(ABS_DIFF(x1, x2) + ABS_DIFF(y1, y2));
 }
+#endif
 
-/* Find node in open set, returns index or -1 if not found */
-static int16_t find_in_open(uint16_t idx) {
-  for (i = 0; i < open_count; ++i) {
-    if (open_set[i].index == idx) {
-      return (int16_t)i;
-    }
+/*
+  Raises h_score to max |d(L, goal) - d(L, cell)| over the landmarks,
+  cell being astar_node. Both bounds are consistent, so their max is.
+  A landmark that cannot reach both cells gives no bound.
+*/
+static void landmark_heuristic(void) {
+  for (l = 0; l < live_landmarks; ++l) {
+    d = landmark[l][astar_node];
+    if (d == LANDMARK_FAR || goal_dist[l] == LANDMARK_FAR) continue;
+    d = ABS_DIFF(d, goal_dist[l]);
+    if (d > h_score) h_score = d;
   }
-  return -1;
 }
 
-/* Remove node from open set at position */
-static void remove_from_open(uint16_t pos) {
-  /* Shift remaining elements */
-  for (i = pos; i < open_count - 1; ++i) {
-    open_set[i] = open_set[i + 1];
+/* Heap key of astar_node, at (x1, y1), reached with g = astar_g */
+static uint16_t open_key(uint8_t x1, uint8_t y1) {
+  h_score = heuristic(x1, y1, destX, destY);
+  if (live_landmarks) landmark_heuristic();
+  if (weight != ASTAR_WEIGHT_ONE) {
+    h_score = h_score <= MAX_HEURISTIC ? weighted_h[h_score] : (h_score * weight) >> 2;
+  }
+  switch (tie) {
+    case ASTAR_TIE_HIGH_G:
+      /* Same f: smaller h means larger g */
+      cross = h_score;
+      break;
+    case ASTAR_TIE_LINE:
+      /* Same f: smaller cross product with the start-goal vector */
+      cross = (int16_t)(int8_t)(x1 - destX) * line_dy
+            - (int16_t)(int8_t)(y1 - destY) * line_dx;
+      cross = ABS(cross) >> 2;
+      break;
+    default:
+      return astar_g + h_score;
   }
-  --open_count;
+  return ((astar_g + h_score) << TIE_BITS) | (cross < TIE_MAX ? cross : TIE_MAX);
 }
 
-/* Find node with lowest f score in open set */
-static uint16_t find_lowest_f(void) {
-  uint16_t lowest_idx = 0;
-  cost_t lowest_f = open_set[0].f;
-  
-  for (i = 1; i < open_count; ++i) {
-    if (open_set[i].f < lowest_f) {
-      lowest_f = open_set[i].f;
-      lowest_idx = i;
+/* Every g to the max value (G_NONE) */
+static void clear_g(void) {
+  wram_owner = WRAM_OWNER_ASTAR;
+  memset(g_lo, 0xFF, GRID_CELLS);
+#ifdef ASTAR_COMPACT
+  memset(g_top, 0xFF, PACKED_BYTES);
+#else
+  memset(g_hi, 0xFF, GRID_CELLS);
+#endif
+}
+
+/* Put (astar_node, astar_key) at hole and sift it up */
+static void heap_sift_up(void) {
+  while (hole > 1 && HEAP_KEY(hole >> 1) > astar_key) {
+    HEAP_MOVE(hole, hole >> 1);
+    hole >>= 1;
+  }
+  heap_node_lo[hole] = (uint8_t)astar_node;
+  heap_node_hi[hole] = (uint8_t)(astar_node >> 8);
+  heap_key_lo[hole]  = (uint8_t)astar_key;
+  heap_key_hi[hole]  = (uint8_t)(astar_key >> 8);
+}
+
+/*
+  Open set and neighbor kernels: the inner loop of solve_astar().
+*/
+
+static SOLVER_LOCAL uint8_t   last_lo, last_hi;
+static SOLVER_LOCAL uint16_t  last_key;
+
+static void astar_open_reset(void) {
+  astar_count = 0;
+}
+
+/* Insert (astar_node, astar_key), sifting up. FALSE if full */
+static bool astar_open_push(void) {
+  if (astar_count == MAX_OPEN_SET) return FALSE;
+  hole = ++astar_count;
+  heap_sift_up();
+  return TRUE;
+}
+
+/* Remove the root: returns its cell, its f goes to astar_key */
+static uint16_t astar_open_pop(void) {
+  astar_node = heap_node_lo[1] | (heap_node_hi[1] << 8);
+  astar_key  = HEAP_KEY(1);
+
+  /* Sift the last entry down from the root */
+  last_lo  = heap_node_lo[astar_count];
+  last_hi  = heap_node_hi[astar_count];
+  last_key = HEAP_KEY(astar_count);
+  --astar_count;
+  hole = 1;
+  while (hole < 128 && (child = hole << 1) <= astar_count) {
+    if (child < astar_count && HEAP_KEY(child + 1) < HEAP_KEY(child)) ++child;
+    if (HEAP_KEY(child) >= last_key) break;
+    HEAP_MOVE(hole, child);
+    hole = child;
+  }
+  heap_node_lo[hole] = last_lo;
+  heap_node_hi[hole] = last_hi;
+  heap_key_lo[hole]  = (uint8_t)last_key;
+  heap_key_hi[hole]  = (uint8_t)(last_key >> 8);
+
+  return astar_node;
+}
+
+/*
+  List the neighbors of astar_node that are open, not closed and
+  improved by going through it: their g and parent are updated and
+  astar_g is their new g (with GRID_DIAGONAL, astar_nb_g holds it).
+*/
+static void astar_expand(void) {
+  uint8_t dir;
+
+#ifdef GRID_DIAGONAL
+  g_here = G_SCORE(astar_node);
+#else
+  astar_g = G_SCORE(astar_node) + 1;
+#endif
+  astar_nb_count = 0;
+  y = GRID_Y(astar_node);
+  x = GRID_X(astar_node);
+
+  for (dir = 0; dir < ASTAR_DIRS; ++dir) {
+    nx = x + grid_dx[dir];
+    ny = y + grid_dy[dir];
+    if (!IN_BOUNDS_X(nx) || !IN_BOUNDS_Y(ny)) continue;
+
+    neighbor_index = GRID_INDEX(nx, ny);
+    if (IS_SOLID(nx, ny) || IN_CLOSED(neighbor_index)) continue;
+#ifdef GRID_DIAGONAL
+    if (dir < 4) {
+      astar_g = g_here + ASTAR_STRAIGHT_COST;
+    } else {
+      if (!GRID_CORNERS_OPEN(x, y, nx, ny)) continue;
+      astar_g = g_here + ASTAR_DIAGONAL_COST;
     }
+    astar_nb_g[astar_nb_count] = astar_g;
+#endif
+    if (astar_g >= G_SCORE(neighbor_index)) continue;
+
+    SET_G(neighbor_index, astar_g);
+    SET_PARENT(neighbor_index, astar_node, dir);
+
+    astar_nb_lo[astar_nb_count] = (uint8_t)neighbor_index;
+    astar_nb_hi[astar_nb_count] = (uint8_t)(neighbor_index >> 8);
+    astar_nb_x[astar_nb_count]  = nx;
+    astar_nb_y[astar_nb_count]  = ny;
+    ++astar_nb_count;
   }
-  
-  return lowest_idx;
 }
 
-/* Add node to open set (or update if exists with better path) */
-static bool add_to_open(uint16_t idx, uint16_t parent_idx, cost_t g, cost_t f) {
-  int16_t existing;
-  
-  /* Check if already in open set */
-  existing = find_in_open(idx);
-  if (existing >= 0) {
-    /* Update if we found a better path */
-    if (g < open_set[existing].g) {
-      open_set[existing].g = g;
-      open_set[existing].f = f;
-      open_set[existing].parent = parent_idx;
+/*
+  Open set full: the entry with the largest key (a leaf of the heap,
+  or astar_node itself) is dropped, and astar_node takes its place.
+  A dropped cell keeps its g and parent, and its key is remembered:
+  the open set is rebuilt before anything beyond it is expanded.
+*/
+static void open_push_full(void) {
+  hole = 0;
+  worst_key = astar_key;
+  child = astar_count;
+  do {
+    if (HEAP_KEY(child) > worst_key) {
+      worst_key = HEAP_KEY(child);
+      hole = child;
     }
-    return TRUE;
+  } while (--child > (uint8_t)(astar_count >> 1));
+
+  /* Stale entries (cell already closed) are not missed */
+  if (hole) {
+    current_index = heap_node_lo[hole] | (heap_node_hi[hole] << 8);
+    if (!IN_CLOSED(current_index) && worst_key < forgot_key) forgot_key = worst_key;
+    heap_sift_up();
+  } else if (worst_key < forgot_key) {
+    forgot_key = worst_key;
   }
-  
-  /* Add new node if space available */
-  if (open_count < MAX_OPEN_SET) {
-    open_set[open_count].index = idx;
-    open_set[open_count].parent = parent_idx;
-    open_set[open_count].g = g;
-    open_set[open_count].f = f;
-    ++open_count;
-    return TRUE;
+  astar_status = ASTAR_FOUND_FULL;
+}
+
+/*
+  Refills the open set with every cell that has a g but is not
+  closed. Such a g is the best one through the closed set, as the
+  closed cells are never reopened, so nothing dropped is lost.
+*/
+static void open_rebuild(void) {
+  astar_open_reset();
+  forgot_key = FORGOT_NONE;
+  for (astar_node = 0; astar_node < GRID_CELLS; ++astar_node) {
+    if (IN_CLOSED(astar_node)) continue;
+    astar_g = G_SCORE(astar_node);
+    if (astar_g == G_NONE) continue;
+    astar_key = open_key(GRID_X(astar_node), GRID_Y(astar_node));
+    if (!astar_open_push()) open_push_full();
   }
-  
-  return FALSE; /* Open set full */
 }
 
 /* Reconstruct path from parent map */
@@ -168,26 +434,26 @@ static int16_t reconstruct_path(uint16_t start_idx, uint16_t goal_idx) {
   trace_index = goal_idx;
   
   /* Trace back from goal to start */
-  while (trace_index != start_idx && num_nodes < STACK_SIZE) {
-    y = (uint8_t)(trace_index / SIZE_X);
-    x = (uint8_t)(trace_index % SIZE_X);
+  while (trace_index != start_idx && num_nodes < WAYPOINT_COUNT) {
+    y = GRID_Y(trace_index);
+    x = GRID_X(trace_index);
     
     waypointX[num_nodes] = x;
     waypointY[num_nodes] = y;
     ++num_nodes;
     
-    trace_index = parent_map[trace_index];
+    trace_index = PARENT_OF(trace_index);
     
     /* Safety check for corrupted parent map */
-    if (trace_index >= CELL_COUNT) {
+    if (trace_index >= GRID_CELLS) {
       return 0;
     }
   }
   
   /* Add start point */
-  if (num_nodes < STACK_SIZE) {
-    y = (uint8_t)(start_idx / SIZE_X);
-    x = (uint8_t)(start_idx % SIZE_X);
+  if (num_nodes < WAYPOINT_COUNT) {
+    y = GRID_Y(start_idx);
+    x = GRID_X(start_idx);
     waypointX[num_nodes] = x;
     waypointY[num_nodes] = y;
     ++num_nodes;
@@ -210,101 +476,124 @@ static int16_t reconstruct_path(uint16_t start_idx, uint16_t goal_idx) {
 }
 
 int16_t __fastcall__ solve_astar(uint8_t sx, uint8_t sy, uint8_t dx, uint8_t dy) {
-  uint8_t dir;
-  uint16_t current_pos;
-  cost_t current_g;
   
   /* Reject invalid / degenerate requests */
+  astar_status = ASTAR_NO_PATH;
   if (sx == dx && sy == dy) return 0;
   if (!IN_BOUNDS_X(sx) || !IN_BOUNDS_X(dx) || !IN_BOUNDS_Y(sy) || !IN_BOUNDS_Y(dy)) return 0;
   if (IS_SOLID(sx, sy) || IS_SOLID(dx, dy)) return 0;
+  astar_status = ASTAR_FOUND;
   
-  /* Initialize */
-  memset(closed_set, 0, CLOSED_BYTES);
-  memset(g_score, 0xFF, sizeof(g_score)); /* Initialize to max value */
+  /* Initialize: swamps (see swamp.h) start closed */
+  swamp_seed(astar_closed, sx, sy, dx, dy);
+  clear_g();
   
-  open_count = 0;
+  astar_open_reset();
+  forgot_key = FORGOT_NONE;
   destX = dx;
   destY = dy;
   
   /* Calculate indices */
-  index = (uint16_t)((sy * SIZE_X) + sx);
-  destIndex = (uint16_t)((dy * SIZE_X) + dx);
+  index = GRID_INDEX(sx, sy);
+  destIndex = GRID_INDEX(dx, dy);
   
   /* Initialize start node */
-  g_score[index] = 0;
-  parent_map[index] = index;
-  h_score = heuristic(sx, sy, dx, dy);
+  SET_G(index, 0);
+  SET_PARENT(index, index, 0);
   
-  if (!add_to_open(index, index, 0, h_score)) {
-    return 0; /* Failed to add start node */
+  /* The tables describe area: anything else would overestimate */
+  live_landmarks = grid_map == GRID_MAP_AREA ? landmarks : 0;
+  for (l = 0; l < live_landmarks; ++l) {
+    goal_dist[l] = landmark[l][destIndex];
   }
+  line_dx = (int8_t)(sx - dx);
+  line_dy = (int8_t)(sy - dy);
+  astar_expanded = 0;
+  
+  astar_node = index;
+  astar_g = 0;
+  astar_key = open_key(sx, sy);
+  astar_open_push();
   
   /* Main A* loop */
-  while (open_count > 0) {
-    /* Find node with lowest f score */
-    current_pos = find_lowest_f();
-    current_index = open_set[current_pos].index;
-    current_g = open_set[current_pos].g;
+  while (astar_count || forgot_key != FORGOT_NONE) {
+    /* Dropped entries come back before a larger key is expanded */
+    if (forgot_key != FORGOT_NONE && (!astar_count || HEAP_KEY(1) > forgot_key)) {
+      open_rebuild();
+      continue;
+    }
+    
+    /* Take the node with lowest f score */
+    current_index = astar_open_pop();
+    
+    /* Skip stale entries left behind by better paths */
+    if (IN_CLOSED(current_index)) continue;
     
     /* Check if we reached the goal */
     if (current_index == destIndex) {
-      return reconstruct_path(index, destIndex);
+      num_nodes = reconstruct_path(index, destIndex);
+      if (!num_nodes) astar_status = ASTAR_NO_PATH;
+      return num_nodes;
     }
     
-    /* Move current from open to closed */
-    remove_from_open(current_pos);
+    /* Move current to closed */
     ADD_TO_CLOSED(current_index);
+    ++astar_expanded;
+    VIS_EVENT(VIS_EXPANDED, current_index);
     
-    /* Get current coordinates */
-    y = (uint8_t)(current_index / SIZE_X);
-    x = (uint8_t)(current_index % SIZE_X);
+    /* Record better paths to the neighbors */
+    astar_expand();
     
-    /* Explore neighbors */
-    for (dir = 0; dir < 4; ++dir) {
-      /* Calculate neighbor position */
-      nx = x + dir_dx[dir];
-      ny = y + dir_dy[dir];
-      
-      /* Check bounds */
-      if (!IN_BOUNDS_X(nx) || !IN_BOUNDS_Y(ny)) continue;
-      
-      /* Calculate neighbor index */
-      neighbor_index = (uint16_t)((ny * SIZE_X) + nx);
-      
-      /* Skip if solid or already in closed set */
-      if (IS_SOLID(nx, ny) || IN_CLOSED(neighbor_index)) continue;
-      
-      /* Calculate tentative g score */
-      tentative_g = current_g + 1; /* Cost is always 1 for adjacent cells */
-      
-      /* Skip if not a better path */
-      if (tentative_g >= g_score[neighbor_index]) continue;
-      
-      /* This is a better path, record it */
-      parent_map[neighbor_index] = current_index;
-      g_score[neighbor_index] = tentative_g;
-      
-      /* Calculate f score */
-      h_score = heuristic(nx, ny, destX, destY);
-      new_f = tentative_g + h_score;
-      
-      /* Add to open set (or update if already there) */
-      if (!add_to_open(neighbor_index, current_index, tentative_g, new_f)) {
-        /* Open set full - this shouldn't happen with reasonable mazes */
-        /* but we need to handle it gracefully */
-        continue;
-      }
+    /* Push them with f = g + w * h */
+    for (n = 0; n < astar_nb_count; ++n) {
+      astar_node = astar_nb_lo[n] | (astar_nb_hi[n] << 8);
+#ifdef GRID_DIAGONAL
+      astar_g = astar_nb_g[n];
+#endif
+      astar_key = open_key(astar_nb_x[n], astar_nb_y[n]);
+      if (!astar_open_push()) open_push_full();
+      VIS_EVENT(VIS_FRONTIER, astar_node);
     }
   }
   
   /* No path found */
+  astar_status = ASTAR_NO_PATH;
   return 0;
 }
 
 void __fastcall__ initialize_astar_solver(void) {
   /* Clear all data structures */
-  memset(closed_set, 0, CLOSED_BYTES);
-  memset(g_score, 0xFF, sizeof(g_score));
-  open_count = 0;
-}
\ No newline at end of file
+  memset(astar_closed, 0, CLOSED_BYTES);
+  clear_g();
+  astar_open_reset();
+}
+
+/*
+  Weighted A* without reopening closed nodes still returns paths
+  within weight / 4 of the shortest one (h is consistent), so the
+  closed set handling above does not change with the mode.
+*/
+void __fastcall__ astar_set_mode(uint8_t w, uint8_t t) {
+  if (w < ASTAR_WEIGHT_ONE) w = ASTAR_WEIGHT_ONE;
+  if (w > ASTAR_WEIGHT_MAX) w = ASTAR_WEIGHT_MAX;
+  weight = w;
+  tie = t;
+  
+  /* h * weight / 4, rounded down (keeps the bound) */
+  for (i = 0; i <= MAX_HEURISTIC; ++i) {
+    weighted_h[i] = (weight_t)((i * w) >> 2);
+  }
+}
+
+void __fastcall__ astar_set_landmarks(const uint8_t* dist, uint8_t count) {
+  if (count > ASTAR_MAX_LANDMARKS) count = ASTAR_MAX_LANDMARKS;
+#ifdef GRID_DIAGONAL
+  /* 4-connected distances overestimate 8-connected ones */
+  count = 0;
+#endif
+  landmarks = count;
+  for (l = 0; l < count; ++l) {
+    landmark[l] = dist;
+    dist += GRID_CELLS;
+  }
+}
@@ -27,6 +27,8 @@ Under the following terms:
 #define ASTAR_H
 
 #include "neslib.h"
+#include "grid.h"
+#include "wram.h"
 #include <inttypes.h>
 
 #define SIZE_OF_ARRAY(array) \
@@ -35,20 +37,85 @@ Under the following terms:
 #define LAST_INDEX_OF(array) \
   (sizeof(array) / sizeof(array[0]) - 1)
 
-#define ABS(n) ( \
-  n < 0 ? -n : n \
-)
+/*
+  Compact node state: parents as 2-bit directions (240 bytes) and g
+  as 10 bits (1.2 KB), with a 127-entry open set (512 bytes), for
+  under 2 KB of WRAM instead of 4.8 KB. Paths stay shortest. It is
+  4-connected only and uses the C kernels.
+*/
+//#define ASTAR_COMPACT
+
+#if defined(ASTAR_COMPACT) && defined(GRID_DIAGONAL)
+#error "ASTAR_COMPACT is 4-connected, undefine GRID_DIAGONAL"
+#endif
+
+/*
+  Step costs. With GRID_DIAGONAL, a straight step costs 2 and a
+  diagonal one 3 (1.5 per straight step, close to sqrt(2)), and h
+  is the octile distance in the same units.
+*/
+#ifdef GRID_DIAGONAL
+#define ASTAR_DIRS          8
+#define ASTAR_STRAIGHT_COST 2
+#define ASTAR_DIAGONAL_COST 3
+#else
+#define ASTAR_DIRS          4
+#define ASTAR_STRAIGHT_COST 1
+#endif
 
-#define ABS_DIFF(a, b) ( \
-  a < b ? b - a : a - b \
-)
+/* Heuristic weight, in quarters: f = g + h * weight / 4 */
+#define ASTAR_WEIGHT_ONE  4   /* Exact A*, shortest paths          */
+#define ASTAR_WEIGHT_MAX  16  /* Paths up to 4x the shortest one   */
 
-#define STACK_SIZE 30*32
+/* Order of open nodes with the same f */
+#define ASTAR_TIE_FIRST   0   /* Whichever the open set yields     */
+#define ASTAR_TIE_HIGH_G  1   /* Deepest first (smallest h)        */
+#define ASTAR_TIE_LINE    2   /* Closest to the start-goal line    */
+
+/* Landmark tables astar_set_landmarks() can take */
+#define ASTAR_MAX_LANDMARKS 8
+
+/*
+  Open set entries (a binary heap). When it is full, the entries
+  with the largest f are dropped and found again later from the g
+  table, so paths are never lost, only slower.
+*/
+#ifndef ASTAR_OPEN_SIZE
+#ifdef ASTAR_COMPACT
+#define ASTAR_OPEN_SIZE   127
+#else
+#define ASTAR_OPEN_SIZE   255
+#endif
+#endif
 
-#define waypointX    (*(volatile uint8_t (*)[STACK_SIZE])(0x6800))
-#define waypointY    (*(volatile uint8_t (*)[STACK_SIZE])(0x6C00))
+/* Outcome of the last solve_astar() call */
+#define ASTAR_FOUND       0
+#define ASTAR_NO_PATH     1
+#define ASTAR_FOUND_FULL  2   /* Found, after the open set filled up */
+
+extern SOLVER_LOCAL uint8_t astar_status;
+
+/* Nodes expanded by the last solve_astar() call */
+extern SOLVER_LOCAL uint16_t astar_expanded;
 
 void __fastcall__ initialize_astar_solver(void);
 int16_t __fastcall__ solve_astar(uint8_t sx, uint8_t sy, uint8_t dx, uint8_t dy);
 
+/*
+  Weighted A*: paths are at most weight / 4 times longer than the
+  shortest one, usually found in far fewer expansions. Stays in
+  effect for every following solve_astar() call.
+*/
+void __fastcall__ astar_set_mode(uint8_t weight, uint8_t tie);
+
+/*
+  Adds the landmark (ALT) bound to the heuristic: count tables of
+  32x30 BFS distances of area, one after the other (see landmarks.h).
+  Used only while grid_solid holds area (grid_map == GRID_MAP_AREA):
+  a world window or a caller grid searches without them, and they
+  come back with the next grid_load_area(). count = 0 turns it off.
+  Ignored with GRID_DIAGONAL: the tables count 4-connected steps.
+*/
+void __fastcall__ astar_set_landmarks(const uint8_t* dist, uint8_t count);
+
 #endif // astar.h
@@ -0,0 +1,215 @@
+/*
+============================================================
+Solver Benchmark - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#include "bench.h"
+#include <string.h>
+
+#define MAGIC_0         'B'
+#define MAGIC_1         'M'
+#define SOLVER          3
+#define QUERIES         4
+#define DONE            5
+#define PASSES          6
+#define SYSTEM          7
+
+/* CPU cycles per frame, rounded */
+#define NTSC_CYCLES     29781
+#define PAL_CYCLES      33248
+
+/* Results screen: one row per query, bars on a log scale */
+#define ROW_FIRST       9
+#define BAR_X           24
+#define BAR_WIDTH       7
+#define BAR_MIN_BITS    10  /* One '#' from 1024 cycles... */
+#define BAR_STEP_BITS   3   /* ...and one more per factor of 8 */
+
+#ifndef BENCH_AREA_SCRIPT
+const BenchQuery bench_script[BENCH_QUERIES] = {
+  { 1,  1,  2,  1},   /* Adjacent cells                  */
+  {16,  9, 16, 11},   /* Around the end of a wall        */
+  { 1, 22, 30, 22},   /* Straight corridor               */
+  { 1,  1, 30, 28},   /* Corner to corner                */
+  {17, 28, 16,  6},   /* Long detour: 59 steps, 23 apart */
+  { 1,  1, 18, 24},   /* Unreachable: walled-in goal     */
+  {25, 24,  1,  1},   /* Unreachable: walled-in start    */
+};
+#endif
+
+static const char* const solver_name[6] = {"A*", "DFS", "IDA*", "PATHDB", "LRTA*", "SUBGOAL"};
+
+/* Frames counted by the NMI callback */
+static volatile uint16_t ticks;
+
+/* Frames the solver kept the CPU, for the results screen */
+static uint16_t  frames[BENCH_QUERIES];
+
+/* Static variables */
+static uint16_t  start;
+static uint16_t  passes, frame_passes;
+static uint16_t  cycles_per_frame;
+static uint16_t  elapsed;
+static uint16_t  path_nodes;
+static uint32_t  cycles, total_cycles;
+static uint16_t  total_frames;
+static uint8_t   tick;
+static uint8_t   found;
+static uint8_t*  rec;
+static uint8_t   i, n;
+static char      line[16];
+
+/* Runs inside the NMI: ++ticks is inc/bne/inc, so it leaves the
+   cc65 stack and zero page temporaries of the main code alone */
+static void bench_nmi(void) {
+  ++ticks;
+}
+
+/* Waits for the next NMI, counting idle passes meanwhile. Only the
+   low byte is compared, it cannot change halfway through a read */
+static void wait_tick(void) {
+  passes = 0;
+  tick = (uint8_t)ticks;
+  while ((uint8_t)ticks == tick) {
+    ++passes;
+  }
+}
+
+void __fastcall__ bench_init(uint8_t solver) {
+  for (i = 0; i < BENCH_BYTES; ++i) {
+    bench_wram[i] = 0;
+  }
+  bench_wram[0] = MAGIC_0;
+  bench_wram[1] = MAGIC_1;
+  bench_wram[2] = BENCH_VERSION;
+  bench_wram[SOLVER] = solver;
+  bench_wram[QUERIES] = BENCH_QUERIES;
+  bench_wram[SYSTEM] = ppu_system() ? 1 : 0;
+  cycles_per_frame = ppu_system() ? NTSC_CYCLES : PAL_CYCLES;
+  nmi_set_callback(bench_nmi);
+}
+
+void __fastcall__ bench_begin(void) {
+  bench_wram[DONE] = 0;
+  wait_tick();
+  wait_tick();
+  frame_passes = passes;
+}
+
+void __fastcall__ bench_start(void) {
+  wait_tick();
+  start = ticks;
+}
+
+void __fastcall__ bench_stop(uint8_t query, int16_t nodes, uint16_t work) {
+  wait_tick();
+  elapsed = ticks - start;
+  frames[query] = elapsed - 1;
+
+  /* Whole frames since the start, minus the idle part of the last */
+  if (passes > frame_passes) passes = frame_passes;
+  cycles = (uint32_t)elapsed * cycles_per_frame -
+           (uint32_t)passes * cycles_per_frame / frame_passes;
+
+  rec = &bench_wram[BENCH_HEADER + query * BENCH_RECORD];
+  rec[0] = (uint8_t)cycles;
+  rec[1] = (uint8_t)(cycles >> 8);
+  rec[2] = (uint8_t)(cycles >> 16);
+  rec[3] = (uint8_t)(cycles >> 24);
+  rec[4] = (uint8_t)nodes;
+  rec[5] = (uint8_t)((uint16_t)nodes >> 8);
+  rec[6] = (uint8_t)work;
+  rec[7] = (uint8_t)(work >> 8);
+  bench_wram[DONE] = query + 1;
+}
+
+void __fastcall__ bench_end(void) {
+  if (bench_wram[PASSES] < 255) ++bench_wram[PASSES];
+}
+
+static void put_text(uint8_t x, uint8_t y, const char* text) {
+  vram_adr(NTADR_A(x, y));
+  vram_write(text, strlen(text));
+}
+
+/* Decimal, right-aligned in width cells from x */
+static void put_number(uint8_t x, uint8_t y, uint32_t value, uint8_t width) {
+  n = width;
+  do {
+    line[--n] = '0' + (uint8_t)(value % 10);
+    value /= 10;
+  } while (value && n);
+  while (n) line[--n] = ' ';
+  vram_adr(NTADR_A(x, y));
+  vram_write(line, width);
+}
+
+static void put_bar(uint8_t y) {
+  /* Bit length of cycles, then one cell per BAR_STEP_BITS */
+  n = 0;
+  while (n < 32 && (cycles >> n)) ++n;
+  if (n < BAR_MIN_BITS) return;
+  n = (n - BAR_MIN_BITS) / BAR_STEP_BITS + 1;
+  if (n > BAR_WIDTH) n = BAR_WIDTH;
+  vram_adr(NTADR_A(BAR_X, y));
+  vram_fill('#', n);
+}
+
+void __fastcall__ bench_draw(void) {
+  vram_adr(NTADR_A(0, 0));
+  vram_fill(' ', 32*30);
+
+  put_text(2, 3, "BENCHMARK");
+  if (bench_wram[SOLVER] < 6) put_text(13, 3, solver_name[bench_wram[SOLVER]]);
+  put_text(26, 3, bench_wram[SYSTEM] ? "NTSC" : "PAL");
+  put_text(2, 5, "PASS");
+  put_number(7, 5, bench_wram[PASSES], 3);
+  put_text(2, 7, "Q LEN   FRM    CYCLES LOG8");
+
+  total_cycles = 0;
+  total_frames = 0;
+  found = 0;
+  for (i = 0; i < bench_wram[DONE]; ++i) {
+    rec = &bench_wram[BENCH_HEADER + i * BENCH_RECORD];
+    cycles = rec[0] | ((uint16_t)rec[1] << 8) |
+             ((uint32_t)rec[2] << 16) | ((uint32_t)rec[3] << 24);
+    path_nodes = rec[4] | (rec[5] << 8);
+    if (path_nodes) ++found;
+    total_cycles += cycles;
+    total_frames += frames[i];
+
+    put_number(2, ROW_FIRST + i, i, 1);
+    put_number(4, ROW_FIRST + i, path_nodes, 3);
+    put_number(8, ROW_FIRST + i, frames[i], 5);
+    put_number(13, ROW_FIRST + i, cycles, 10);
+    put_bar(ROW_FIRST + i);
+  }
+
+  put_text(2, ROW_FIRST + BENCH_QUERIES + 1, "TOTAL");
+  put_number(8, ROW_FIRST + BENCH_QUERIES + 1, total_frames, 5);
+  put_number(13, ROW_FIRST + BENCH_QUERIES + 1, total_cycles, 10);
+  put_text(2, ROW_FIRST + BENCH_QUERIES + 3, "PATHS");
+  put_number(8, ROW_FIRST + BENCH_QUERIES + 3, found, 1);
+  put_text(10, ROW_FIRST + BENCH_QUERIES + 3, "OF");
+  put_number(13, ROW_FIRST + BENCH_QUERIES + 3, i, 1);
+}
@@ -0,0 +1,102 @@
+/*
+============================================================
+Solver Benchmark - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "neslib.h"
+#include "wram.h"
+#include <inttypes.h>
+
+/*
+  Self-running benchmark (BENCHMARK in main.c): a fixed script of
+  queries over area is solved over and over, each one timed in
+  frames and CPU cycles, and the results are shown on screen and
+  kept in a reserved WRAM area (bench_wram) for headless runs to
+  dump and decode with tools/bench.c.
+
+  Timing: an NMI callback counts frames in 16 bits. Each solve
+  starts right after an NMI; once it returns, an idle loop counts
+  its passes until the next one. The passes a whole frame takes
+  are measured at the start of every run, so
+
+    cycles = frames * CYCLES_PER_FRAME - idle passes * cycles per pass
+
+  which is wall-clock time (NMI handler included), within one
+  idle pass (about 30 cycles).
+
+    0  'B', 'M'   magic
+    2  version
+    3  solver id (TELEMETRY_astar...)
+    4  queries in the script
+    5  queries done in the current pass
+    6  passes completed (saturates at 255)
+    7  1 = NTSC, 0 = PAL
+    8  records, one per query
+
+  Record: cycles (32 bits), path nodes (16 bits), work (16 bits:
+  the solver's expansion counter), little endian.
+*/
+/*
+  Takes the script from the map linked as area instead of bench.c:
+  the maps in maps/corpus, or made by tools/mapgen.c and
+  tools/movingai.c, carry one.
+*/
+//#define BENCH_AREA_SCRIPT
+
+#define BENCH_VERSION   1
+#define BENCH_HEADER    8
+#define BENCH_RECORD    8
+#define BENCH_QUERIES   ((BENCH_BYTES - BENCH_HEADER) / BENCH_RECORD)
+
+/* Frames each path stays on screen, and the results */
+#define BENCH_SHOW      60
+#define BENCH_HOLD      240
+
+typedef struct BenchQuery {
+  uint8_t sx, sy, dx, dy;
+} BenchQuery;
+
+extern const BenchQuery bench_script[BENCH_QUERIES];
+
+/* Installs the frame counter and starts an empty record */
+void __fastcall__ bench_init(uint8_t solver);
+
+/* Calibrates the idle loop, call before each pass */
+void __fastcall__ bench_begin(void);
+
+/* Waits for the next NMI and starts the clock */
+void __fastcall__ bench_start(void);
+
+/* Stops the clock and records the solve of bench_script[query] */
+void __fastcall__ bench_stop(uint8_t query, int16_t nodes, uint16_t work);
+
+/* Counts a completed pass */
+void __fastcall__ bench_end(void);
+
+/* Draws the results over the whole screen (rendering off) */
+void __fastcall__ bench_draw(void);
+
+#endif // bench.h
@@ -0,0 +1,225 @@
+/*
+============================================================
+Crowd Agents - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#include "crowd.h"
+#include "astar.h"
+
+#if (CROWD_MAX_AGENTS & (CROWD_MAX_AGENTS - 1)) || CROWD_MAX_AGENTS > 32
+#error "CROWD_MAX_AGENTS must be a power of two, up to 32"
+#endif
+
+#define AGENT_MASK      (CROWD_MAX_AGENTS - 1)
+
+/* A run byte is (direction << 5) | cells, cells in [1..31], 8 directions */
+#define RUN_DIR(r_)     ((r_) >> 5)
+#define RUN_CELLS(r_)   ((r_) & 0x1F)
+#define RUN_MAX_CELLS   0x1F
+
+/* Step between first agents drawn on consecutive frames (odd) */
+#define ROTATE_STEP     7
+
+/* Paths: start cell + straight runs. A slot is free when unused */
+static uint8_t  path_x[CROWD_MAX_PATHS];
+static uint8_t  path_y[CROWD_MAX_PATHS];
+static uint8_t  path_runs[CROWD_MAX_PATHS];
+static uint8_t  path_users[CROWD_MAX_PATHS];
+static uint8_t  path_run[CROWD_MAX_PATHS][CROWD_PATH_RUNS];
+
+/* Agents, one array per field (CROWD_NONE path = free slot) */
+static uint8_t  agent_path[CROWD_MAX_AGENTS];
+static uint8_t  agent_run[CROWD_MAX_AGENTS];   /* Step cursor: run...   */
+static uint8_t  agent_left[CROWD_MAX_AGENTS];  /* ...and pixels left   */
+static uint8_t  agent_delay[CROWD_MAX_AGENTS];
+static uint8_t  agent_px[CROWD_MAX_AGENTS];
+static uint8_t  agent_py[CROWD_MAX_AGENTS];
+static uint8_t  agent_born[CROWD_MAX_AGENTS];  /* Spawn count at spawn */
+
+/* Static variables */
+static uint8_t   a, p, n, r;
+static uint8_t   dir;
+static uint8_t   x, y, nx, ny;
+static uint16_t  i;
+static uint8_t   rotate;
+static uint8_t   framecount;
+static uint8_t   tile;
+static uint8_t   born;
+
+static void restart_agent(void) {
+  r = path_run[p][0];
+  agent_run[a]  = 0;
+  agent_left[a] = RUN_CELLS(r) << 3;
+  agent_px[a]   = path_x[p] << 3;
+  agent_py[a]   = path_y[p] << 3;
+}
+
+void __fastcall__ crowd_init(void) {
+  for (a = 0; a < CROWD_MAX_AGENTS; ++a) {
+    agent_path[a] = CROWD_NONE;
+  }
+  for (p = 0; p < CROWD_MAX_PATHS; ++p) {
+    path_users[p] = 0;
+  }
+  rotate = 0;
+  tile = CROWD_SPRITE;
+}
+
+/* NOTE: a stored path is only kept while an agent walks it. */
+uint8_t __fastcall__ crowd_store_path(int16_t count) {
+  if (count < 2) return CROWD_NONE;
+
+  /* Find a free slot */
+  for (p = 0; p < CROWD_MAX_PATHS; ++p) {
+    if (!path_users[p]) break;
+  }
+  if (p == CROWD_MAX_PATHS) return CROWD_NONE;
+
+  x = waypointX[0];
+  y = waypointY[0];
+  path_x[p] = x;
+  path_y[p] = y;
+
+  /* Collapse unit steps into runs */
+  n = 0;
+  r = 0;
+  for (i = 1; i < (uint16_t)count; ++i) {
+    nx = waypointX[i];
+    ny = waypointY[i];
+    for (dir = 0; dir < 8; ++dir) {
+      if (nx == (uint8_t)(x + grid_dx[dir]) && ny == (uint8_t)(y + grid_dy[dir])) break;
+    }
+    if (dir == 8) return CROWD_NONE; /* Not a walkable path */
+
+    if (r && RUN_DIR(r) == dir && RUN_CELLS(r) < RUN_MAX_CELLS) {
+      ++r;
+    } else {
+      if (r) {
+        if (n == CROWD_PATH_RUNS) return CROWD_NONE;
+        path_run[p][n++] = r;
+      }
+      r = (dir << 5) | 1;
+    }
+    x = nx;
+    y = ny;
+  }
+  if (n == CROWD_PATH_RUNS) return CROWD_NONE;
+  path_run[p][n++] = r;
+  path_runs[p] = n;
+
+  return p;
+}
+
+/* Oldest agent, by spawn count (wraps every 256 spawns) */
+static uint8_t oldest_agent(void) {
+  r = 0;
+  n = 0;
+  for (a = 0; a < CROWD_MAX_AGENTS; ++a) {
+    if ((uint8_t)(born - agent_born[a]) > r) {
+      r = born - agent_born[a];
+      n = a;
+    }
+  }
+  return n;
+}
+
+uint8_t __fastcall__ crowd_spawn(uint8_t path, uint8_t delay) {
+  if (path >= CROWD_MAX_PATHS) return CROWD_NONE;
+
+  for (a = 0; a < CROWD_MAX_AGENTS; ++a) {
+    if (agent_path[a] == CROWD_NONE) break;
+  }
+  if (a == CROWD_MAX_AGENTS) {
+    a = oldest_agent();
+    crowd_remove(a);
+  }
+
+  p = path;
+  ++path_users[p];
+  agent_path[a]  = p;
+  agent_delay[a] = delay;
+  agent_born[a]  = born++;
+  restart_agent();
+
+  return a;
+}
+
+void __fastcall__ crowd_remove(uint8_t agent) {
+  if (agent >= CROWD_MAX_AGENTS) return;
+  p = agent_path[agent];
+  if (p == CROWD_NONE) return;
+  --path_users[p];
+  agent_path[agent] = CROWD_NONE;
+}
+
+void __fastcall__ crowd_update(void) {
+  /* Shared walk animation */
+  if (++framecount == 16) {
+    framecount = 0;
+    if (++tile >= CROWD_SPRITE + CROWD_FRAMES) {
+      tile = CROWD_SPRITE;
+    }
+  }
+
+  for (a = 0; a < CROWD_MAX_AGENTS; ++a) {
+    p = agent_path[a];
+    if (p == CROWD_NONE) continue;
+    if (agent_delay[a]) {
+      --agent_delay[a];
+      continue;
+    }
+
+    /* One pixel along the current run */
+    n = RUN_DIR(path_run[p][agent_run[a]]);
+    agent_px[a] += grid_dx[n];
+    agent_py[a] += grid_dy[n];
+
+    if (--agent_left[a]) continue;
+
+    /* Next run, or back to the start (same as the single follower) */
+    n = agent_run[a] + 1;
+    if (n >= path_runs[p]) {
+      restart_agent();
+    } else {
+      agent_run[a]  = n;
+      agent_left[a] = RUN_CELLS(path_run[p][n]) << 3;
+    }
+  }
+}
+
+/*
+  OAM multiplexing: the NES shows at most 8 sprites per scanline and drops
+  the ones with higher OAM indices. Starting from a different agent every
+  frame spreads the dropped sprites over time, turning them into flicker.
+*/
+uint8_t __fastcall__ crowd_draw(uint8_t sprid) {
+  a = rotate;
+  for (n = 0; n < CROWD_MAX_AGENTS; ++n) {
+    if (agent_path[a] != CROWD_NONE && !agent_delay[a]) {
+      sprid = oam_spr(agent_px[a], agent_py[a] - 1, tile, a & 3, sprid);
+    }
+    a = (a + 1) & AGENT_MASK;
+  }
+  rotate = (rotate + ROTATE_STEP) & AGENT_MASK;
+  return sprid;
+}
@@ -0,0 +1,73 @@
+/*
+============================================================
+Crowd Agents - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#ifndef CROWD_H
+#define CROWD_H
+
+#include "neslib.h"
+#include <inttypes.h>
+
+/* Agent table size (power of two, at most 32) */
+#ifndef CROWD_MAX_AGENTS
+#define CROWD_MAX_AGENTS 16
+#endif
+
+/* Stored paths, shared by any number of agents */
+#ifndef CROWD_MAX_PATHS
+#define CROWD_MAX_PATHS  8
+#endif
+
+/* Run bytes per stored path (one per straight segment) */
+#ifndef CROWD_PATH_RUNS
+#define CROWD_PATH_RUNS  32
+#endif
+
+#define CROWD_NONE       0xFF
+
+/* Agent sprite tiles (animated) */
+#define CROWD_SPRITE     0x18
+#define CROWD_FRAMES     3
+
+void __fastcall__ crowd_init(void);
+
+/* Stores waypointX/waypointY[0..count) as a path, returns its handle */
+uint8_t __fastcall__ crowd_store_path(int16_t count);
+
+/*
+  Adds an agent walking path, starting after delay frames. With
+  every slot taken, the oldest agent is removed to make room.
+*/
+uint8_t __fastcall__ crowd_spawn(uint8_t path, uint8_t delay);
+
+/* Removes an agent, and its path once no other agent uses it (ignores bad ids) */
+void __fastcall__ crowd_remove(uint8_t agent);
+
+/* Per-frame movement */
+void __fastcall__ crowd_update(void);
+
+/* Writes all agents to OAM in rotating order, returns next sprid */
+uint8_t __fastcall__ crowd_draw(uint8_t sprid);
+
+#endif // crowd.h
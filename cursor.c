@@ -43,7 +43,10 @@ void __fastcall__ cursor_init(byte mode, char sprite) {
 }
 
 #define CURSOR_SCREEN_POSITION \
-  ((int16_t)cursor.x - (int16_t)0)//camera.x)
+  ((int16_t)cursor.x - (int16_t)camera.x)
+
+#define CURSOR_SCREEN_POSITION_Y \
+  ((int16_t)cursor.y - (int16_t)camera.y)
 
 #define CURSOR_LEFT \
   (cursor.mx > 0 && (gamepad_state & PAD_LEFT) && CURSOR_SCREEN_POSITION > 0 + 8)
@@ -55,7 +58,7 @@ void __fastcall__ cursor_init(byte mode, char sprite) {
   (cursor.my > 1 && (gamepad_state & PAD_UP))
 
 #define CURSOR_DOWN \
-  (cursor.my < MAP_SIZE_Y && (gamepad_state & PAD_DOWN))
+  (cursor.my < MAP_SIZE_Y && (gamepad_state & PAD_DOWN) && CURSOR_SCREEN_POSITION_Y < 240 - 16)
 
 void __fastcall__ cursor_move(void) {
   gamepad_state = pad_poll(0);
@@ -28,6 +28,7 @@ Under the following terms:
 #define _CURSOR_H
 
 #include "neslib.h"
+#include "world.h"
 #include <inttypes.h>
 
 #define OFF                0
@@ -36,8 +37,8 @@ Under the following terms:
 #define TILE_MODE          0
 #define PIXEL_MODE         1
 
-#define MAP_SIZE_X        32
-#define MAP_SIZE_Y        32
+#define MAP_SIZE_X        WORLD_SIZE_X
+#define MAP_SIZE_Y        WORLD_SIZE_Y
 
 typedef struct Cursor {
   uint16_t x;
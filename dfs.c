@@ -24,71 +24,91 @@ Under the following terms:
 ============================================================
 */
 #include "dfs.h"
-#include "area.h"
-
-#define ONE                       (byte)1
-#define BIT_ON(v, n)              (v |= (ONE << (n)))
-#define BIT_OFF(v, n)             (v &= (byte)~(ONE << (n)))
-#define BIT_VALUE(v, n)           (((v) >> (n)) & ONE)
-#define BIT_ARRAY_SET(a, i)       BIT_ON(    (a)[(i) / 8], ((i) % 8) )
-#define BIT_ARRAY_UNSET(a, i)     BIT_OFF(   (a)[(i) / 8], ((i) % 8) )
-#define BIT_ARRAY_VALUE(a, i)     BIT_VALUE( (a)[(i) / 8], ((i) % 8) )
-
-#define SIZE_X 32
-#define SIZE_Y 30 /* last 2 lines never displayed */
+#include "grid.h"
+#include "swamp.h"
+#include "vis.h"
 
 typedef uint8_t bit8_t;
 
-#define stack    (*(volatile uint16_t (*)[STACK_SIZE])(0x6000))
+#define stack    dfs_stack
+
+/* Hot state lives in the zero page */
+#pragma bss-name (push, "ZEROPAGE")
 
 /* Stack index goes negative */
-static int16_t   stack_index;
+static SOLVER_LOCAL int16_t   stack_index;
 
 /* Waypoint indexes go negative */
-static int16_t   waypoint_index;
-
-/* Always positive */
-static uint16_t  index;
-static uint16_t  destIndex;
-static uint16_t  newIndex;
+static SOLVER_LOCAL int16_t   waypoint_index;
 
 /* Always positive */
-static uint16_t  i;
-static uint16_t  c, k;
-static uint16_t  num_nodes;
-static uint16_t  end;
+static SOLVER_LOCAL uint16_t  index;
+static SOLVER_LOCAL uint16_t  newIndex;
 
 /* Always positive [0..31] */
-static uint8_t   x;
-static uint8_t   y;
-static uint8_t   tmp;
+static SOLVER_LOCAL uint8_t   x;
+static SOLVER_LOCAL uint8_t   y;
 
 /* Distances go negative */
-static int8_t    distX;
-static int8_t    distY;
+static SOLVER_LOCAL int8_t    distX;
+static SOLVER_LOCAL int8_t    distY;
+
+/* Visited bitmap byte and bit of the last tested cell */
+static SOLVER_LOCAL uint8_t   visited_index;
+static SOLVER_LOCAL uint8_t   visited_bit;
+
+#pragma bss-name (pop)
+
+/* Always positive */
+static SOLVER_LOCAL uint16_t  destIndex;
+
+/* Always positive */
+static SOLVER_LOCAL uint16_t  i;
+static SOLVER_LOCAL uint16_t  c, k;
+static SOLVER_LOCAL uint16_t  num_nodes;
+static SOLVER_LOCAL uint16_t  end;
+
+static SOLVER_LOCAL uint8_t   tmp;
+
+#ifdef GRID_DIAGONAL
+/* Goal-ward diagonal neighbor */
+static SOLVER_LOCAL uint8_t   nx, ny;
+#endif
 
 /* Visited */
-#define CELL_COUNT      (SIZE_X * SIZE_Y)
-#define VISITED_BYTES   ((CELL_COUNT + 7) / 8)
-static bit8_t    visited[VISITED_BYTES];
-static uint16_t  visited_index;
+#define VISITED_BYTES   GRID_BYTES
+static SOLVER_LOCAL bit8_t    visited[VISITED_BYTES];
 
 /* Always positive [0..31] */
-static uint8_t   startX, startY;
-static uint8_t   destX, destY;
+static SOLVER_LOCAL uint8_t   startX, startY;
+static SOLVER_LOCAL uint8_t   destX, destY;
 
 /* Control variables */
-static bool      is_horizontal;
-static bool      done;
-static uint8_t   pass;
+static SOLVER_LOCAL bool      is_horizontal;
+static SOLVER_LOCAL bool      done;
+static SOLVER_LOCAL uint8_t   pass;
 
 /* Optimization: cache bounds and distance values */
-static uint8_t   can_right, can_left, can_down, can_up;
-static uint8_t   abs_distX, abs_distY;
-static uint8_t   new_x, new_y;
+static SOLVER_LOCAL uint8_t   can_right, can_left, can_down, can_up;
+static SOLVER_LOCAL uint8_t   abs_distX, abs_distY;
+
+SOLVER_LOCAL uint16_t         dfs_expanded;
+
+#ifdef DFS_PACKED_STACK
+/*
+  Frame k > 0 of the stack is the step (right, left, down, up) from
+  frame k - 1, in slot k: four per byte, lowest bits first. index is
+  the top frame's cell; popping undoes the step.
+*/
+static SOLVER_LOCAL uint8_t   steps[DFS_STEP_BYTES];
+static SOLVER_LOCAL uint8_t   step;
+
+#define STEP_AT(k_)       GRID_SLOT_AT(steps, k_)
+#define SET_STEP(k_, d_)  GRID_SET_SLOT(steps, k_, d_)
+#endif
 
 #define IS_SOLID(x_, y_) ( \
-  area[(y_)][(x_)] != ' ' \
+  GRID_SOLID(x_, y_) \
 )
 
 /* NOTE: Do not clear elements on POP; clearing is wasted cycles on NES. */
@@ -109,21 +129,29 @@ static uint8_t   new_x, new_y;
 )
 
 #define SET_VISITED_AT(i_) ( \
-  visited_index = (uint16_t)(i_), \
-  BIT_ARRAY_SET(visited, visited_index) \
+  visited_index = GRID_CELL_BYTE(i_), \
+  visited[visited_index] |= GRID_CELL_BIT(i_) \
+)
+
+/* Neither visited nor solid: one bitmap lookup for both */
+#define IS_OPEN(i_) ( \
+  visited_index = GRID_CELL_BYTE(i_), \
+  visited_bit = GRID_CELL_BIT(i_), \
+  ((visited[visited_index] | grid_solid[visited_index]) & visited_bit) == 0 \
 )
 
-#define NOT_VISITED(i_) ( \
-  visited_index = (uint16_t)(i_), \
-  (BIT_ARRAY_VALUE(visited, visited_index) == 0) \
+/* Right after a successful IS_OPEN() on the same cell */
+#define SET_VISITED_LAST() ( \
+  visited[visited_index] |= visited_bit \
 )
 
-#define IN_BOUNDS_X(x_) ((x_) < SIZE_X)
-#define IN_BOUNDS_Y(y_) ((y_) < SIZE_Y)
+#define IN_BOUNDS_X(x_) ((x_) < GRID_SIZE_X)
+#define IN_BOUNDS_Y(y_) ((y_) < GRID_SIZE_Y)
 
 int16_t __fastcall__ solve_dfs(uint8_t sx, uint8_t sy, uint8_t dx, uint8_t dy) {
   /* Init */
   pass = 0;
+  dfs_expanded = 0;
   
   /* Reject invalid / degenerate requests */
   if ((sx == dx && sy == dy)) return 0;
@@ -133,10 +161,8 @@ int16_t __fastcall__ solve_dfs(uint8_t sx, uint8_t sy, uint8_t dx, uint8_t dy) {
 solve:
   ++pass;
   
-  /* Reset visited map (small: 120 bytes for 32x30) */
-  for (visited_index = 0; visited_index < (uint16_t)SIZE_OF_ARRAY(visited); ++visited_index) {
-    visited[visited_index] = 0;
-  }
+  /* Reset visited map (small: 120 bytes for 32x30), swamps visited */
+  swamp_seed(visited, sx, sy, dx, dy);
   
   /* Get the start point */
   startX = sx;
@@ -147,22 +173,26 @@ solve:
   destY = dy;
   
   /* Start (x, y) index */
-  index = (uint16_t)((startY * SIZE_X) + startX);
+  index = GRID_INDEX(startX, startY);
   
   /* Destination (x, y) index */
-  destIndex = (uint16_t)((destY * SIZE_X) + destX);
+  destIndex = GRID_INDEX(destX, destY);
   
   /* Empty the stack and waypoints (logical reset only, no memory clearing) */
   stack_index = -1;
   waypoint_index = -1;
   
   /* Push start and mark visited on push (prevents duplicates) */
+#ifdef DFS_PACKED_STACK
+  stack_index = 0;
+#else
   PUSH(stack, index);
+#endif
   SET_VISITED_AT(index);
   
   while (!EMPTY(stack)) {
     /* Guard: avoid writing past arrays (check BEFORE pushing). */
-    if (stack_index >= (STACK_SIZE - 1)) {
+    if (stack_index >= (WAYPOINT_COUNT - 1)) {
       if (pass < 2) {
         x  = dx; y  = dy;
         dx = sx; dy = sy;
@@ -173,20 +203,24 @@ solve:
     }
     
     /* Get current */
+#ifndef DFS_PACKED_STACK
     index = TOP(stack);
+#endif
     
     /* Compute coordinates */
-    y = (uint8_t)(index / SIZE_X);
-    x = (uint8_t)(index % SIZE_X);
+    y = GRID_Y(index);
+    x = GRID_X(index);
     
     /* If the goal is reached... */
     if (index == destIndex) {
+#ifndef DFS_PACKED_STACK
       /* Include goal in waypoints */
-      if (waypoint_index < (STACK_SIZE - 1)) {
+      if (waypoint_index < (WAYPOINT_COUNT - 1)) {
         ++waypoint_index;
         waypointX[waypoint_index] = x;
         waypointY[waypoint_index] = y;
       }
+#endif
       break;
     }
     
@@ -202,29 +236,41 @@ solve:
     is_horizontal = (abs_distX > abs_distY);
     
     /* Cache bounds checks */
-    can_right = (x < (SIZE_X - 1));
+    can_right = (x < (GRID_SIZE_X - 1));
     can_left = (x > 0);
-    can_down = (y < (SIZE_Y - 1));
+    can_down = (y < (GRID_SIZE_Y - 1));
     can_up = (y > 0);
     
     /* Select next cell to visit */
     newIndex = 0;
     
+#ifdef GRID_DIAGONAL
+    /* Diagonal first when the goal is off both axes, not across a corner */
+    if (distX && distY) {
+      nx = distX > 0 ? x + 1 : x - 1;
+      ny = distY > 0 ? y + 1 : y - 1;
+      if (IN_BOUNDS_X(nx) && IN_BOUNDS_Y(ny) && GRID_CORNERS_OPEN(x, y, nx, ny)) {
+        newIndex = GRID_INDEX(nx, ny);
+        if (IS_OPEN(newIndex)) {
+          goto push_node;
+        }
+      }
+    }
+#endif
+    
     if (is_horizontal) {
       /* Horizontal first */
       if (distX > 0) { /* left -> right */
         if (can_right) {
-          new_x = x + 1;
           newIndex = index + 1;
-          if (NOT_VISITED(newIndex) && IS_SOLID(new_x, y) == 0) {
+          if (IS_OPEN(newIndex)) {
             goto push_node;
           }
         }
       } else { /* right -> left */
         if (can_left) {
-          new_x = x - 1;
           newIndex = index - 1;
-          if (NOT_VISITED(newIndex) && IS_SOLID(new_x, y) == 0) {
+          if (IS_OPEN(newIndex)) {
             goto push_node;
           }
         }
@@ -233,31 +279,27 @@ solve:
       /* Vertical axis */
       if (distY > 0) { /* low -> up (in your coordinate system) */
         if (can_down) {
-          new_y = y + 1;
-          newIndex = index + SIZE_X;
-          if (NOT_VISITED(newIndex) && IS_SOLID(x, new_y) == 0) {
+          newIndex = index + GRID_SIZE_X;
+          if (IS_OPEN(newIndex)) {
             goto push_node;
           }
         }
         if (can_up) {
-          new_y = y - 1;
-          newIndex = index - SIZE_X;
-          if (NOT_VISITED(newIndex) && IS_SOLID(x, new_y) == 0) {
+          newIndex = index - GRID_SIZE_X;
+          if (IS_OPEN(newIndex)) {
             goto push_node;
           }
         }
       } else { /* high -> down */
         if (can_up) {
-          new_y = y - 1;
-          newIndex = index - SIZE_X;
-          if (NOT_VISITED(newIndex) && IS_SOLID(x, new_y) == 0) {
+          newIndex = index - GRID_SIZE_X;
+          if (IS_OPEN(newIndex)) {
             goto push_node;
           }
         }
         if (can_down) {
-          new_y = y + 1;
-          newIndex = index + SIZE_X;
-          if (NOT_VISITED(newIndex) && IS_SOLID(x, new_y) == 0) {
+          newIndex = index + GRID_SIZE_X;
+          if (IS_OPEN(newIndex)) {
             goto push_node;
           }
         }
@@ -266,17 +308,15 @@ solve:
       /* Last possible direction */
       if (distX > 0) {
         if (can_left) {
-          new_x = x - 1;
           newIndex = index - 1;
-          if (NOT_VISITED(newIndex) && IS_SOLID(new_x, y) == 0) {
+          if (IS_OPEN(newIndex)) {
             goto push_node;
           }
         }
       } else {
         if (can_right) {
-          new_x = x + 1;
           newIndex = index + 1;
-          if (NOT_VISITED(newIndex) && IS_SOLID(new_x, y) == 0) {
+          if (IS_OPEN(newIndex)) {
             goto push_node;
           }
         }
@@ -285,17 +325,15 @@ solve:
       /* Vertical first */
       if (distY > 0) { /* low -> up */
         if (can_down) {
-          new_y = y + 1;
-          newIndex = index + SIZE_X;
-          if (NOT_VISITED(newIndex) && IS_SOLID(x, new_y) == 0) {
+          newIndex = index + GRID_SIZE_X;
+          if (IS_OPEN(newIndex)) {
             goto push_node;
           }
         }
       } else { /* high -> down */
         if (can_up) {
-          new_y = y - 1;
-          newIndex = index - SIZE_X;
-          if (NOT_VISITED(newIndex) && IS_SOLID(x, new_y) == 0) {
+          newIndex = index - GRID_SIZE_X;
+          if (IS_OPEN(newIndex)) {
             goto push_node;
           }
         }
@@ -304,31 +342,27 @@ solve:
       /* Horizontal axis */
       if (distX > 0) { /* left -> right */
         if (can_right) {
-          new_x = x + 1;
           newIndex = index + 1;
-          if (NOT_VISITED(newIndex) && IS_SOLID(new_x, y) == 0) {
+          if (IS_OPEN(newIndex)) {
             goto push_node;
           }
         }
         if (can_left) {
-          new_x = x - 1;
           newIndex = index - 1;
-          if (NOT_VISITED(newIndex) && IS_SOLID(new_x, y) == 0) {
+          if (IS_OPEN(newIndex)) {
             goto push_node;
           }
         }
       } else { /* right -> left */
         if (can_left) {
-          new_x = x - 1;
           newIndex = index - 1;
-          if (NOT_VISITED(newIndex) && IS_SOLID(new_x, y) == 0) {
+          if (IS_OPEN(newIndex)) {
             goto push_node;
           }
         }
         if (can_right) {
-          new_x = x + 1;
           newIndex = index + 1;
-          if (NOT_VISITED(newIndex) && IS_SOLID(new_x, y) == 0) {
+          if (IS_OPEN(newIndex)) {
             goto push_node;
           }
         }
@@ -337,17 +371,15 @@ solve:
       /* Last possible direction */
       if (distY > 0) {
         if (can_up) {
-          new_y = y - 1;
-          newIndex = index - SIZE_X;
-          if (NOT_VISITED(newIndex) && IS_SOLID(x, new_y) == 0) {
+          newIndex = index - GRID_SIZE_X;
+          if (IS_OPEN(newIndex)) {
             goto push_node;
           }
         }
       } else {
         if (can_down) {
-          new_y = y + 1;
-          newIndex = index + SIZE_X;
-          if (NOT_VISITED(newIndex) && IS_SOLID(x, new_y) == 0) {
+          newIndex = index + GRID_SIZE_X;
+          if (IS_OPEN(newIndex)) {
             goto push_node;
           }
         }
@@ -356,25 +388,63 @@ solve:
     
     /* Backtrack: pop current frame + corresponding waypoint entry */
     if (stack_index >= 0) {
+      VIS_EVENT(VIS_DEAD_END, index);
+#ifdef DFS_PACKED_STACK
+      if (stack_index) index -= grid_step[STEP_AT(stack_index)];
+      POP(stack);
+#else
       POP(stack);
       --waypoint_index;
+#endif
     }
     continue;
     
 push_node:
+#ifdef DFS_PACKED_STACK
+    /* Push the step that leads to newIndex */
+    if      (newIndex == index + 1)      step = 0;
+    else if (newIndex + 1 == index)      step = 1;
+    else if (newIndex > index)           step = 2;
+    else                                 step = 3;
+    ++stack_index;
+    SET_STEP(stack_index, step);
+    index = newIndex;
+    SET_VISITED_LAST();
+    ++dfs_expanded;
+    VIS_EVENT(VIS_EXPANDED, newIndex);
+#else
     /* Push waypoint and stack together */
-    if (waypoint_index < (STACK_SIZE - 1)) {
+    if (waypoint_index < (WAYPOINT_COUNT - 1)) {
       ++waypoint_index;
       waypointX[waypoint_index] = x;
       waypointY[waypoint_index] = y;
       ++stack_index;
       stack[stack_index] = newIndex;
-      SET_VISITED_AT(newIndex);
+      SET_VISITED_LAST();
+      ++dfs_expanded;
+      VIS_EVENT(VIS_EXPANDED, newIndex);
     }
+#endif
   }
   
   /* No solution */
   if (EMPTY(stack)) return 0;
+
+#ifdef DFS_PACKED_STACK
+  /* Unpack the stack into waypoints, start first */
+  x = startX;
+  y = startY;
+  waypointX[0] = x;
+  waypointY[0] = y;
+  for (i = 1; i <= (uint16_t)stack_index; ++i) {
+    step = STEP_AT(i);
+    x += grid_dx[step];
+    y += grid_dy[step];
+    waypointX[i] = x;
+    waypointY[i] = y;
+  }
+  waypoint_index = stack_index;
+#endif
   if (waypoint_index < 0) return 0;
   
   /* Path length is waypoint count */
@@ -413,6 +483,15 @@ push_node:
           done = FALSE;
           break;
         }
+#ifdef GRID_DIAGONAL
+        /* Diagonal neighbor, not across a corner */
+        if (ABS_DIFF(sx, dx) == 1 && ABS_DIFF(sy, dy) == 1 &&
+            GRID_CORNERS_OPEN(sx, sy, dx, dy)) {
+          i = c - 1;
+          done = FALSE;
+          break;
+        }
+#endif
       }
       ++i;
       ++k;
@@ -427,3 +506,6 @@ push_node:
   return (int16_t)num_nodes;
 }
 
+void __fastcall__ initialize_dfs_solver(void) {
+  /* Nothing to set up: every search starts from a clean state */
+}
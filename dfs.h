@@ -28,6 +28,8 @@ Under the following terms:
 #define DFS_H
 
 #include "neslib.h"
+#include "grid.h"
+#include "wram.h"
 
 #include <inttypes.h>
 
@@ -37,18 +39,31 @@ Under the following terms:
 #define LAST_INDEX_OF(array) \
   (sizeof(array) / sizeof(array[0]) - 1)
 
-#define ABS(n) ( \
-  n < 0 ? -n : n \
-)
+/*
+  Keeps the search stack as 2-bit steps in internal RAM (240 bytes)
+  instead of cell indexes in WRAM (1.9 KB), and only writes
+  waypointX/waypointY once a path is found, leaving the rest of
+  WRAM to other systems. Same paths, same search.
+*/
+//#define DFS_PACKED_STACK
 
-#define ABS_DIFF(a, b) ( \
-  a < b ? b - a : a - b \
-)
+/*
+  With GRID_DIAGONAL, the search steps diagonally toward the goal
+  whenever it is off both axes and neither corner is solid (the A*
+  rule), then falls back to the four straight moves. Diagonals away
+  from the goal are never tried: they only come from the path
+  cleanup. Paths are not shortest either way.
+*/
+#if defined(DFS_PACKED_STACK) && defined(GRID_DIAGONAL)
+#error "DFS_PACKED_STACK is 4-connected, undefine GRID_DIAGONAL"
+#endif
 
-#define STACK_SIZE 30*32
+#ifdef DFS_PACKED_STACK
+#define DFS_STEP_BYTES  (GRID_CELLS / 4)
+#endif
 
-#define waypointX    (*(volatile uint8_t (*)[STACK_SIZE])(0x6800))
-#define waypointY    (*(volatile uint8_t (*)[STACK_SIZE])(0x6C00))
+/* Cells entered by the last solve_dfs() call, both passes */
+extern SOLVER_LOCAL uint16_t dfs_expanded;
 
 void __fastcall__ initialize_dfs_solver(void);
 int16_t __fastcall__ solve_dfs(uint8_t sx, uint8_t sy, uint8_t dx, uint8_t dy);
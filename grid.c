@@ -0,0 +1,149 @@
+/*
+============================================================
+Solver Grid - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#include "grid.h"
+#include "wram.h"
+#include "area.h"
+
+SOLVER_LOCAL uint8_t grid_solid[GRID_BYTES];
+SOLVER_LOCAL uint8_t grid_map = GRID_MAP_OTHER;
+
+SOLVER_LOCAL uint8_t wram_owner = WRAM_OWNER_NONE;
+
+#ifndef __CC65__
+SOLVER_LOCAL uint8_t wram[WRAM_SIZE];
+#endif
+
+/* Bit of a cell within its byte, x & 7 -> mask (no variable shifts) */
+const uint8_t grid_bit[8] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80};
+
+/* Right, left, down, up, then the diagonals */
+const int8_t grid_dx[8]   = {1, -1, 0, 0, 1, -1, 1, -1};
+const int8_t grid_dy[8]   = {0, 0, 1, -1, 1, 1, -1, -1};
+const int8_t grid_step[4] = {1, -1, GRID_SIZE_X, -GRID_SIZE_X};
+
+/* Mask and shift of 2-bit slot i & 3 in a packed byte */
+const uint8_t grid_slot_mask[4]  = {0x03, 0x0C, 0x30, 0xC0};
+const uint8_t grid_slot_shift[4] = {0, 2, 4, 6};
+
+#define R8(v_)   v_, v_, v_, v_, v_, v_, v_, v_
+#define R16(v_)  R8(v_), R8(v_)
+#define R32(v_)  R16(v_), R16(v_)
+#define R64(v_)  R32(v_), R32(v_)
+
+/* y * GRID_SIZE_X for rows y..y+n-1, n a power of two */
+#define ROWS1(y_)   (y_) * GRID_SIZE_X,
+#define ROWS2(y_)   ROWS1(y_) ROWS1((y_) + 1)
+#define ROWS4(y_)   ROWS2(y_) ROWS2((y_) + 2)
+#define ROWS8(y_)   ROWS4(y_) ROWS4((y_) + 4)
+#define ROWS16(y_)  ROWS8(y_) ROWS8((y_) + 8)
+#define ROWS32(y_)  ROWS16(y_) ROWS16((y_) + 16)
+#define ROWS64(y_)  ROWS32(y_) ROWS32((y_) + 32)
+
+/* Exactly GRID_SIZE_Y rows, one block per bit of it */
+const uint16_t grid_row[GRID_SIZE_Y] = {
+#if GRID_SIZE_Y & 64
+  ROWS64(0)
+#endif
+#if GRID_SIZE_Y & 32
+  ROWS32(GRID_SIZE_Y & 64)
+#endif
+#if GRID_SIZE_Y & 16
+  ROWS16(GRID_SIZE_Y & 96)
+#endif
+#if GRID_SIZE_Y & 8
+  ROWS8(GRID_SIZE_Y & 112)
+#endif
+#if GRID_SIZE_Y & 4
+  ROWS4(GRID_SIZE_Y & 120)
+#endif
+#if GRID_SIZE_Y & 2
+  ROWS2(GRID_SIZE_Y & 124)
+#endif
+#if GRID_SIZE_Y & 1
+  ROWS1(GRID_SIZE_Y & 126)
+#endif
+};
+
+/* Row of each low index byte: GRID_SIZE_X equal values per row */
+#if GRID_SHIFT_X == 3
+#define RX(v_)   R8(v_)
+#elif GRID_SHIFT_X == 4
+#define RX(v_)   R16(v_)
+#elif GRID_SHIFT_X == 5
+#define RX(v_)   R32(v_)
+#else
+#define RX(v_)   R64(v_)
+#endif
+#define RX4(v_)  RX(v_), RX((v_) + 1), RX((v_) + 2), RX((v_) + 3)
+
+const uint8_t grid_lo_row[256] = {
+  RX4(0),
+#if GRID_SHIFT_X < 6
+  RX4(4),
+#endif
+#if GRID_SHIFT_X < 5
+  RX4(8), RX4(12),
+#endif
+#if GRID_SHIFT_X < 4
+  RX4(16), RX4(20), RX4(24), RX4(28),
+#endif
+};
+
+const uint8_t grid_lo_byte[256] = {
+  R8( 0), R8( 1), R8( 2), R8( 3), R8( 4), R8( 5), R8( 6), R8( 7),
+  R8( 8), R8( 9), R8(10), R8(11), R8(12), R8(13), R8(14), R8(15),
+  R8(16), R8(17), R8(18), R8(19), R8(20), R8(21), R8(22), R8(23),
+  R8(24), R8(25), R8(26), R8(27), R8(28), R8(29), R8(30), R8(31)
+};
+
+const uint8_t grid_hi_row[4]  = {
+  0, 256 >> GRID_SHIFT_X, 512 >> GRID_SHIFT_X, 768 >> GRID_SHIFT_X
+};
+const uint8_t grid_hi_byte[4] = {0, 32, 64, 96};
+
+static SOLVER_LOCAL uint8_t  x, bits;
+static SOLVER_LOCAL uint8_t* dst;
+
+void __fastcall__ grid_set_row(uint8_t y, register const char* row) {
+  dst = &grid_solid[y << GRID_ROW_SHIFT];
+  grid_map = GRID_MAP_OTHER;
+  bits = 0;
+  for (x = 0; x < GRID_SIZE_X; ++x) {
+    if (row[x] != ' ') bits |= grid_bit[x & 7];
+    if ((x & 7) == 7) {
+      *dst++ = bits;
+      bits = 0;
+    }
+  }
+}
+
+void __fastcall__ grid_load_area(void) {
+  uint8_t y;
+  for (y = 0; y < GRID_SIZE_Y; ++y) {
+    grid_set_row(y, area[y]);
+  }
+  grid_map = GRID_MAP_AREA;
+}
@@ -0,0 +1,182 @@
+/*
+============================================================
+Solver Grid - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#ifndef GRID_H
+#define GRID_H
+
+#include "neslib.h"
+#include <inttypes.h>
+
+/*
+  The solvers never read map tiles directly: they test this
+  passability bitmap, one bit per cell (1 = solid), GRID_SIZE_X / 8
+  bytes per row. It is loaded from area, or from a window of a
+  larger world (see world.h).
+
+  These are the only grid dimensions: the solvers, their tables
+  and WRAM arrays are all sized from them at compile time. Set
+  them here (or with -D in host builds) for a smaller arena, such
+  as 16x15, or a strip such as 64x15, and provide an area of that
+  size. The width must be a power of two from 8 to 64, so that
+  cells index with shifts and masks, and the grid may not hold
+  more than 960 cells (the WRAM layout, see wram.h).
+*/
+#ifndef GRID_SIZE_X
+#define GRID_SIZE_X     32
+#endif
+#ifndef GRID_SIZE_Y
+#define GRID_SIZE_Y     30
+#endif
+
+#if GRID_SIZE_X == 8
+#define GRID_SHIFT_X    3
+#elif GRID_SIZE_X == 16
+#define GRID_SHIFT_X    4
+#elif GRID_SIZE_X == 32
+#define GRID_SHIFT_X    5
+#elif GRID_SIZE_X == 64
+#define GRID_SHIFT_X    6
+#else
+#error "GRID_SIZE_X must be 8, 16, 32 or 64"
+#endif
+
+#define GRID_CELLS      (GRID_SIZE_X * GRID_SIZE_Y)
+#define GRID_ROW_SHIFT  (GRID_SHIFT_X - 3)  /* log2(GRID_ROW_BYTES) */
+#define GRID_ROW_BYTES  (GRID_SIZE_X / 8)
+#define GRID_BYTES      (GRID_ROW_BYTES * GRID_SIZE_Y)
+
+#if GRID_SIZE_Y < 2 || GRID_CELLS > 960
+#error "GRID_SIZE_X x GRID_SIZE_Y must be 2 rows to 960 cells"
+#endif
+
+/*
+  Search state: plain statics on the NES, one copy per thread in
+  host builds, so that batch tools can run a search on every core
+  (see solver.h).
+*/
+#ifdef __CC65__
+#define SOLVER_LOCAL
+#else
+#define SOLVER_LOCAL _Thread_local
+#endif
+
+extern SOLVER_LOCAL uint8_t grid_solid[GRID_BYTES];
+extern const uint8_t grid_bit[8];
+
+/*
+  What grid_solid holds: area as loaded by grid_load_area, or
+  anything else (a world window, a row set by hand, a caller grid).
+  Tables built offline from area (landmarks.h) only apply to the first.
+*/
+#define GRID_MAP_AREA   0
+#define GRID_MAP_OTHER  1
+
+extern SOLVER_LOCAL uint8_t grid_map;
+
+/* Byte of (x, y) in a one-bit-per-cell bitmap laid out like grid_solid */
+#define GRID_BYTE_AT(x_, y_) ( \
+  ((y_) << GRID_ROW_SHIFT) | ((x_) >> 3) \
+)
+
+#define GRID_SOLID(x_, y_) ( \
+  grid_solid[GRID_BYTE_AT(x_, y_)] & grid_bit[(x_) & 7] \
+)
+
+/*
+  8-connected movement: astar also steps diagonally, dfs steps
+  diagonally toward the goal and its path cleanup takes diagonal
+  shortcuts. A diagonal step may not cut a corner: both cells it
+  passes between must be open, so it is never a way through a
+  wall. Paths then hold diagonal steps, which the follower in
+  main.c and crowd.c walk as they are.
+*/
+//#define GRID_DIAGONAL
+
+/*
+  Direction offsets, in the order every solver uses: right, left,
+  down, up, then the diagonals. The reverse of a straight direction
+  d is d ^ 1. grid_step holds the cell index offsets of the four
+  straight ones.
+*/
+extern const int8_t grid_dx[8];
+extern const int8_t grid_dy[8];
+extern const int8_t grid_step[4];
+
+/* Diagonal step from (x, y) to (nx, ny) clears both corners */
+#define GRID_CORNERS_OPEN(x_, y_, nx_, ny_) ( \
+  !GRID_SOLID(nx_, y_) && !GRID_SOLID(x_, ny_) \
+)
+
+/*
+  2-bit fields (steps, directions) packed four to a byte: field i
+  is slot i & 3 of byte i >> 2, masked and shifted through tables.
+*/
+extern const uint8_t grid_slot_mask[4];
+extern const uint8_t grid_slot_shift[4];
+
+#define GRID_SLOT_AT(a_, i_) ( \
+  ((a_)[(i_) >> 2] >> grid_slot_shift[(i_) & 3]) & 3 \
+)
+
+#define GRID_SET_SLOT(a_, i_, v_) ( \
+  (a_)[(i_) >> 2] = \
+    ((a_)[(i_) >> 2] & (uint8_t)~grid_slot_mask[(i_) & 3]) | \
+    ((v_) << grid_slot_shift[(i_) & 3]) \
+)
+
+#define ABS(n) ( \
+  (n) < 0 ? -(n) : (n) \
+)
+
+#define ABS_DIFF(a, b) ( \
+  (a) < (b) ? (b) - (a) : (a) - (b) \
+)
+
+/*
+  Cell index <-> (x, y) and cell bitmap addressing through ROM
+  tables, without multiplies, divides or multi-bit shifts (which
+  cc65 turns into runtime calls). Generated for GRID_SIZE_X.
+*/
+extern const uint16_t grid_row[GRID_SIZE_Y];  /* y * GRID_SIZE_X         */
+extern const uint8_t  grid_lo_row[256];       /* (i & 255) >> shift     */
+extern const uint8_t  grid_lo_byte[256];      /* (i & 255) >> 3         */
+extern const uint8_t  grid_hi_row[4];         /* (i >> 8) << 8 - shift  */
+extern const uint8_t  grid_hi_byte[4];        /* (i >> 8) << 5          */
+
+#define GRID_INDEX(x_, y_)  (grid_row[(y_)] + (x_))
+#define GRID_X(i_)          ((uint8_t)(i_) & (GRID_SIZE_X - 1))
+#define GRID_Y(i_)          (grid_lo_row[(uint8_t)(i_)] + grid_hi_row[(i_) >> 8])
+
+/* Byte and bit of cell i in a one-bit-per-cell bitmap */
+#define GRID_CELL_BYTE(i_)  (grid_lo_byte[(uint8_t)(i_)] + grid_hi_byte[(i_) >> 8])
+#define GRID_CELL_BIT(i_)   (grid_bit[(uint8_t)(i_) & 7])
+
+/* Packs one row of tiles (' ' = open) into the bitmap (grid_map = OTHER) */
+void __fastcall__ grid_set_row(uint8_t y, const char* row);
+
+/* Loads the bitmap from area (grid_map = AREA) */
+void __fastcall__ grid_load_area(void);
+
+#endif // grid.h
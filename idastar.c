@@ -0,0 +1,269 @@
+/*
+============================================================
+Iterative Deepening A* - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#include "idastar.h"
+#include "grid.h"
+#include "swamp.h"
+#ifndef IDASTAR_NO_WAYPOINTS
+#include "wram.h"
+#endif
+#include <string.h>
+
+#if IDASTAR_MAX_DEPTH > 253
+#error "IDASTAR_MAX_DEPTH must be at most 253"
+#endif
+
+/*
+  One depth-first pass per f bound. A step changes g by 1 and the
+  Manhattan h by 1 either way, so f keeps its parity and a child
+  is at most 2 above its parent: a pruned child means the next
+  bound is exactly 2 more.
+  The path so far is a stack of 2-bit directions: going back one
+  step pops the direction taken, undoes it and tries the next one,
+  so no per-depth state is needed besides those two bits.
+
+  Without a closed set, every route to a cell within the bound is
+  walked again. To keep that in check, only "horizontal first"
+  routes are followed: a vertical step may turn sideways only if
+  the cell beside the previous one is solid, since otherwise the
+  same cell is reached as fast by turning one step earlier. Among
+  the shortest paths to the goal, the one taking horizontal steps
+  as early as possible always passes this test.
+*/
+SOLVER_LOCAL uint8_t          idastar_path[IDASTAR_PATH_BYTES];
+SOLVER_LOCAL uint16_t         idastar_expanded;
+
+/* Cells on the current path (cycle check), same layout as grid_solid */
+static SOLVER_LOCAL uint8_t   on_path[GRID_BYTES];
+
+/* Hot state lives in the zero page */
+#pragma bss-name (push, "ZEROPAGE")
+static SOLVER_LOCAL uint8_t   x, y;
+static SOLVER_LOCAL uint8_t   nx, ny;
+static SOLVER_LOCAL uint8_t   destX, destY;
+static SOLVER_LOCAL uint8_t   depth;
+static SOLVER_LOCAL uint8_t   dir;
+static SOLVER_LOCAL uint8_t   last;
+static SOLVER_LOCAL uint8_t   bound;
+static SOLVER_LOCAL uint8_t   h;
+static SOLVER_LOCAL uint8_t   cell_byte;
+static SOLVER_LOCAL uint8_t   cell_bit;
+#pragma bss-name (pop)
+
+static SOLVER_LOCAL bool      pruned;
+static SOLVER_LOCAL bool      changed;
+static SOLVER_LOCAL uint8_t   i, b;
+static SOLVER_LOCAL uint8_t   t, carry;
+static SOLVER_LOCAL uint8_t*  row;
+static SOLVER_LOCAL const uint8_t* solid;
+
+#define HEURISTIC(x_, y_) ( \
+  ABS_DIFF(x_, destX) + ABS_DIFF(y_, destY) \
+)
+
+#define IN_BOUNDS_X(x_) ((x_) < GRID_SIZE_X)
+#define IN_BOUNDS_Y(y_) ((y_) < GRID_SIZE_Y)
+
+/* Neither solid nor on the path, remembering the cell's byte and bit */
+#define IS_OPEN(x_, y_) ( \
+  cell_byte = GRID_BYTE_AT(x_, y_), \
+  cell_bit = grid_bit[(x_) & 7], \
+  ((grid_solid[cell_byte] | on_path[cell_byte]) & cell_bit) == 0 \
+)
+
+#define MARK(x_, y_) ( \
+  on_path[GRID_BYTE_AT(x_, y_)] |= grid_bit[(x_) & 7] \
+)
+
+#define IS_MARKED(x_, y_) ( \
+  on_path[GRID_BYTE_AT(x_, y_)] & grid_bit[(x_) & 7] \
+)
+
+#define UNMARK(x_, y_) ( \
+  on_path[GRID_BYTE_AT(x_, y_)] &= (uint8_t)~grid_bit[(x_) & 7] \
+)
+
+/* Sideways after a vertical step only around a corner (see above) */
+#define IS_CANONICAL() ( \
+  last < IDASTAR_DOWN || dir >= IDASTAR_DOWN || \
+  GRID_SOLID(nx, y - grid_dy[last]) \
+)
+
+#define PUSH_DIR(d_) GRID_SET_SLOT(idastar_path, depth, d_)
+
+#ifndef IDASTAR_NO_WAYPOINTS
+/* Unpacks the path into waypointX/waypointY */
+static void write_waypoints(uint8_t sx, uint8_t sy) {
+  x = sx;
+  y = sy;
+  waypointX[0] = x;
+  waypointY[0] = y;
+  for (i = 0; i < depth; ++i) {
+    dir = IDASTAR_STEP(i);
+    x += grid_dx[dir];
+    y += grid_dy[dir];
+    waypointX[i + 1] = x;
+    waypointY[i + 1] = y;
+  }
+}
+#endif
+
+/* Grows the flood in on_path over row y, from its neighbors too */
+static void flood_row(void) {
+  row = &on_path[y << GRID_ROW_SHIFT];
+  solid = &grid_solid[y << GRID_ROW_SHIFT];
+  
+  /* From the rows above and below */
+  for (b = 0; b < GRID_ROW_BYTES; ++b) {
+    t = row[b];
+    if (y > 0)          t |= row[b - GRID_ROW_BYTES];
+    if (y < GRID_SIZE_Y - 1) t |= row[b + GRID_ROW_BYTES];
+    t &= (uint8_t)~solid[b];
+    if (t != row[b]) changed = TRUE;
+    row[b] = t;
+  }
+  
+  /* Along the row, towards x + 1 then x - 1 */
+  carry = 0;
+  for (b = 0; b < GRID_ROW_BYTES; ++b) {
+    t = (row[b] | carry) & (uint8_t)~solid[b];
+    do {
+      i = t;
+      t = (t | (t << 1)) & (uint8_t)~solid[b];
+    } while (t != i);
+    carry = t >> 7;
+    if (t != row[b]) changed = TRUE;
+    row[b] = t;
+  }
+  carry = 0;
+  for (b = GRID_ROW_BYTES; b-- > 0;) {
+    t = (row[b] | carry) & (uint8_t)~solid[b];
+    do {
+      i = t;
+      t = (t | (t >> 1)) & (uint8_t)~solid[b];
+    } while (t != i);
+    carry = (t & 1) << 7;
+    if (t != row[b]) changed = TRUE;
+    row[b] = t;
+  }
+}
+
+/*
+  Floods the cells connected to (sx, sy) into on_path, sweeping
+  down and up until the goal is reached or nothing changes. An
+  unreachable goal would otherwise cost every bound up to
+  IDASTAR_MAX_DEPTH.
+*/
+static bool is_reachable(uint8_t sx, uint8_t sy) {
+  memset(on_path, 0, GRID_BYTES);
+  MARK(sx, sy);
+  do {
+    changed = FALSE;
+    for (y = 0; y < GRID_SIZE_Y; ++y) flood_row();
+    for (y = GRID_SIZE_Y; y-- > 0;) flood_row();
+    if (IS_MARKED(destX, destY)) return TRUE;
+  } while (changed);
+  return FALSE;
+}
+
+int16_t __fastcall__ solve_idastar(uint8_t sx, uint8_t sy, uint8_t dx, uint8_t dy) {
+  /* Reject invalid / degenerate requests */
+  idastar_expanded = 0;
+  if (sx == dx && sy == dy) return 0;
+  if (!IN_BOUNDS_X(sx) || !IN_BOUNDS_X(dx) || !IN_BOUNDS_Y(sy) || !IN_BOUNDS_Y(dy)) return 0;
+  if (GRID_SOLID(sx, sy) || GRID_SOLID(dx, dy)) return 0;
+  
+  destX = dx;
+  destY = dy;
+  if (!is_reachable(sx, sy)) return 0;
+  bound = HEURISTIC(sx, sy);
+  
+  /* Swamps (see swamp.h) count as on the path. Every pass leaves
+     on_path as it found it, so this is done once */
+  swamp_seed(on_path, sx, sy, dx, dy);
+  MARK(sx, sy);
+  
+  while (bound <= IDASTAR_MAX_DEPTH) {
+    pruned = FALSE;
+    x = sx;
+    y = sy;
+    depth = 0;
+    dir = 0;
+    last = IDASTAR_RIGHT; /* Anything goes after a sideways step */
+    
+    for (;;) {
+      if (dir < 4) {
+        nx = x + grid_dx[dir];
+        ny = y + grid_dy[dir];
+        if (IN_BOUNDS_X(nx) && IN_BOUNDS_Y(ny) && IS_OPEN(nx, ny) && IS_CANONICAL()) {
+          /* depth + 1 + h > bound, without overflowing a byte */
+          h = HEURISTIC(nx, ny);
+          if (h > (uint8_t)(bound - depth - 1)) {
+            pruned = TRUE;
+          } else {
+            /* Step forward */
+            PUSH_DIR(dir);
+            ++depth;
+            on_path[cell_byte] |= cell_bit;
+            if (++idastar_expanded == 0) --idastar_expanded;
+            x = nx;
+            y = ny;
+            last = dir;
+            if (x == destX && y == destY) {
+#ifndef IDASTAR_NO_WAYPOINTS
+              write_waypoints(sx, sy);
+#endif
+              return (int16_t)depth + 1;
+            }
+            dir = 0;
+            continue;
+          }
+        }
+        ++dir;
+      } else {
+        /* Every direction tried: step back */
+        if (depth == 0) break;
+        UNMARK(x, y);
+        --depth;
+        dir = IDASTAR_STEP(depth);
+        x -= grid_dx[dir];
+        y -= grid_dy[dir];
+        last = depth ? IDASTAR_STEP(depth - 1) : IDASTAR_RIGHT;
+        ++dir;
+      }
+    }
+    
+    /* Nothing beyond the bound: the goal is unreachable */
+    if (!pruned) break;
+    bound += 2;
+  }
+  
+  /* No path found (or longer than IDASTAR_MAX_DEPTH) */
+  return 0;
+}
+
+void __fastcall__ initialize_idastar_solver(void) {
+  memset(idastar_path, 0, IDASTAR_PATH_BYTES);
+}
@@ -0,0 +1,69 @@
+/*
+============================================================
+Iterative Deepening A* - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#ifndef IDASTAR_H
+#define IDASTAR_H
+
+#include "neslib.h"
+#include "grid.h"
+#include <inttypes.h>
+
+/*
+  Iterative deepening A*: no open set, no g or parent tables, so
+  it runs without cartridge WRAM. Its memory is the current path,
+  two bits per step, plus the 120-byte on-path bitmap.
+*/
+
+/* Longest path it can find, in steps (at most 255) */
+#ifndef IDASTAR_MAX_DEPTH
+#define IDASTAR_MAX_DEPTH 252
+#endif
+
+/* Path directions, packed 4 per byte, lowest bits first */
+#define IDASTAR_PATH_BYTES ((IDASTAR_MAX_DEPTH + 3) / 4)
+#define IDASTAR_RIGHT     0
+#define IDASTAR_LEFT      1
+#define IDASTAR_DOWN      2
+#define IDASTAR_UP        3
+
+/* Direction of step i (0-based) of the last path found */
+#define IDASTAR_STEP(i_)  GRID_SLOT_AT(idastar_path, i_)
+
+extern SOLVER_LOCAL uint8_t idastar_path[IDASTAR_PATH_BYTES];
+
+/* Steps taken by the last solve_idastar() call, all bounds (saturates) */
+extern SOLVER_LOCAL uint16_t idastar_expanded;
+
+void __fastcall__ initialize_idastar_solver(void);
+
+/*
+  Returns the number of path nodes, start included (0 = no path),
+  like the other solvers. The steps are left in idastar_path and,
+  unless IDASTAR_NO_WAYPOINTS is defined, also written out to
+  waypointX/waypointY (which live in WRAM).
+*/
+int16_t __fastcall__ solve_idastar(uint8_t sx, uint8_t sy, uint8_t dx, uint8_t dy);
+
+#endif // idastar.h
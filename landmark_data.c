@@ -0,0 +1,140 @@
+/* Generated by tools/landmarks.c from area.c -- do not edit */
+#include "landmarks.h"
+
+#if LANDMARK_COUNT != 4
+#error "landmarks.h does not match the number of landmarks"
+#endif
+
+const uint8_t landmark_x[LANDMARK_COUNT] = { 16, 13, 7, 11, };
+const uint8_t landmark_y[LANDMARK_COUNT] = { 28, 5, 28, 17, };
+
+const uint8_t landmark_dist[LANDMARK_COUNT][LANDMARK_CELLS] = {
+  {
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,55,54,53,52,51,50,49,48,47,46,45,44,43,42,41,255,
+    255,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,255,52,51,50,49,48,47,46,45,46,45,255,41,40,255,
+    255,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,255,51,255,255,48,47,255,255,44,255,255,255,255,39,255,
+    255,39,40,41,42,43,255,255,255,255,255,51,52,53,54,55,56,255,50,49,48,47,46,45,44,43,42,41,40,39,38,255,
+    255,38,39,40,41,42,43,44,45,46,47,255,53,54,55,56,57,255,51,50,49,255,45,44,43,42,41,40,255,38,37,255,
+    255,37,255,41,42,41,42,43,44,45,46,47,255,255,255,57,58,255,255,51,50,51,255,255,255,255,255,39,38,37,36,255,
+    255,36,37,255,41,40,41,42,43,44,45,46,47,48,255,255,255,255,255,255,255,255,255,255,255,255,255,38,37,36,35,255,
+    255,35,36,37,255,39,40,41,42,43,44,45,46,47,48,49,48,47,46,45,44,43,42,41,40,39,38,37,36,35,34,255,
+    255,34,35,36,37,38,39,40,41,42,43,44,45,46,47,255,47,46,45,44,43,42,41,40,39,38,37,36,35,34,33,255,
+    255,33,34,35,36,37,38,39,40,41,42,43,255,255,255,47,255,45,44,255,42,41,40,39,38,37,36,35,34,33,32,255,
+    255,32,255,255,35,36,37,38,39,40,41,42,43,44,45,46,45,44,43,42,41,42,41,40,39,38,255,255,255,255,31,255,
+    255,31,32,33,34,35,36,37,38,39,255,41,42,43,44,45,44,43,42,41,40,255,42,41,40,255,34,33,32,31,30,255,
+    255,30,31,32,33,34,35,36,255,40,39,40,41,255,43,44,43,255,41,40,39,38,255,255,255,255,33,32,31,30,29,255,
+    255,29,30,255,255,33,255,255,255,255,38,39,40,41,42,43,42,41,40,39,255,37,36,35,34,33,32,31,30,29,28,255,
+    255,28,29,30,31,32,33,34,255,38,37,38,39,40,41,42,41,40,39,38,37,36,35,34,33,32,31,30,29,28,27,255,
+    255,27,28,29,30,31,32,33,34,255,36,37,38,39,40,255,255,255,255,39,38,37,255,35,255,255,255,29,28,27,26,255,
+    255,26,27,28,29,30,255,32,33,34,35,36,37,255,41,42,43,42,41,40,39,38,255,36,255,255,29,28,27,26,25,255,
+    255,25,26,27,28,29,30,31,32,33,255,255,38,39,40,41,42,43,42,41,40,255,255,37,38,255,28,27,26,25,24,255,
+    255,24,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,25,24,23,255,
+    255,23,22,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,34,33,32,31,30,29,28,27,26,25,24,23,22,255,
+    255,22,21,20,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,21,255,
+    255,21,20,19,18,17,16,15,14,13,12,11,10,9,8,7,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,255,
+    255,20,19,18,17,16,15,14,13,12,11,10,9,8,7,6,5,6,255,10,9,10,11,12,255,255,255,16,17,18,19,255,
+    255,19,255,17,16,15,14,13,12,11,10,9,8,7,6,5,4,255,255,255,8,9,10,11,255,255,255,15,16,17,18,255,
+    255,18,17,16,255,14,13,12,11,10,9,255,255,255,255,4,3,4,255,6,7,8,9,10,255,255,255,14,15,16,17,255,
+    255,17,16,15,255,13,12,11,255,9,8,7,6,5,4,3,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,255,
+    255,16,15,14,13,12,11,10,9,8,7,6,5,4,3,2,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,255,
+    255,15,14,13,12,11,10,9,8,7,6,5,4,3,2,1,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  },
+  {
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,16,15,14,13,12,11,10,9,8,7,6,5,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,255,
+    255,15,14,13,12,11,10,9,8,7,6,5,4,3,4,5,6,255,10,11,12,13,14,15,16,17,18,19,255,21,22,255,
+    255,14,13,12,11,10,9,8,7,6,5,4,3,2,3,4,5,255,11,255,255,14,15,255,255,18,255,255,255,255,23,255,
+    255,15,14,13,12,11,255,255,255,255,255,3,2,1,2,3,4,255,12,13,14,15,16,17,18,19,20,21,22,23,24,255,
+    255,16,15,14,13,12,13,14,15,16,17,255,1,0,1,2,3,255,13,14,15,255,17,18,19,20,21,22,255,24,25,255,
+    255,17,255,15,14,13,14,15,16,17,18,19,255,255,255,3,4,255,255,15,16,17,255,255,255,255,255,23,24,25,26,255,
+    255,18,19,255,15,14,15,16,17,18,19,20,21,22,255,255,255,255,255,255,255,255,255,255,255,255,255,24,25,26,27,255,
+    255,19,20,19,255,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,30,29,28,27,26,25,26,27,28,255,
+    255,20,19,18,17,16,17,18,19,20,21,22,23,24,25,255,27,28,29,30,31,32,31,30,29,28,27,26,27,28,29,255,
+    255,21,20,19,18,17,18,19,20,21,22,23,255,255,255,29,255,29,30,255,32,33,32,31,30,29,28,27,28,29,30,255,
+    255,22,255,255,19,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,33,32,31,30,255,255,255,255,31,255,
+    255,23,22,21,20,19,20,21,22,23,255,25,26,27,28,29,30,31,32,33,34,255,34,33,32,255,36,35,34,33,32,255,
+    255,24,23,22,21,20,21,22,255,24,25,26,27,255,29,30,31,255,33,34,35,36,255,255,255,255,37,36,35,34,33,255,
+    255,25,24,255,255,21,255,255,255,255,26,27,28,29,30,31,32,33,34,35,255,37,38,39,40,39,38,37,36,35,34,255,
+    255,26,25,24,23,22,23,24,255,28,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,40,39,38,37,36,35,255,
+    255,27,26,25,24,23,24,25,26,255,28,29,30,31,32,255,255,255,255,37,38,39,255,41,255,255,255,39,38,37,36,255,
+    255,28,27,26,25,24,255,26,27,28,29,30,31,255,33,34,35,36,37,38,39,40,255,42,255,255,41,40,39,38,37,255,
+    255,29,28,27,26,25,26,27,28,29,255,255,32,33,34,35,36,37,38,39,40,255,255,43,44,255,42,41,40,39,38,255,
+    255,30,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,41,40,39,255,
+    255,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,49,48,47,46,45,44,43,42,41,40,255,
+    255,32,33,34,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,41,255,
+    255,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,51,50,49,48,47,46,45,44,43,42,255,
+    255,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,255,52,53,52,51,50,255,255,255,46,45,44,43,255,
+    255,35,255,37,38,39,40,41,42,43,44,45,46,47,48,49,50,255,255,255,54,53,52,51,255,255,255,47,46,45,44,255,
+    255,36,37,38,255,40,41,42,43,44,45,255,255,255,255,50,51,52,255,56,55,54,53,52,255,255,255,48,47,46,45,255,
+    255,37,38,39,255,41,42,43,255,45,46,47,48,49,50,51,52,53,54,55,56,55,54,53,52,51,50,49,48,47,46,255,
+    255,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,56,55,54,53,52,51,50,49,48,47,255,
+    255,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,57,56,55,54,53,52,51,50,49,48,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  },
+  {
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,55,54,53,52,51,50,255,
+    255,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,255,51,52,53,54,55,56,55,54,55,54,255,50,49,255,
+    255,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,255,52,255,255,55,56,255,255,53,255,255,255,255,48,255,
+    255,30,31,32,33,34,255,255,255,255,255,42,43,44,45,46,47,255,53,54,55,56,55,54,53,52,51,50,49,48,47,255,
+    255,29,30,31,32,33,34,35,36,37,38,255,44,45,46,47,48,255,54,55,56,255,54,53,52,51,50,49,255,47,46,255,
+    255,28,255,32,33,32,33,34,35,36,37,38,255,255,255,48,49,255,255,56,57,58,255,255,255,255,255,48,47,46,45,255,
+    255,27,28,255,32,31,32,33,34,35,36,37,38,39,255,255,255,255,255,255,255,255,255,255,255,255,255,47,46,45,44,255,
+    255,26,27,28,255,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,48,47,46,45,44,43,255,
+    255,25,26,27,28,29,30,31,32,33,34,35,36,37,38,255,42,41,42,43,44,45,46,47,48,47,46,45,44,43,42,255,
+    255,24,25,26,27,28,29,30,31,32,33,34,255,255,255,38,255,40,41,255,43,44,45,46,47,46,45,44,43,42,41,255,
+    255,23,255,255,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,255,255,255,255,40,255,
+    255,22,23,24,25,26,27,28,29,30,255,32,33,34,35,36,37,38,39,40,41,255,45,46,47,255,43,42,41,40,39,255,
+    255,21,22,23,24,25,26,27,255,31,30,31,32,255,34,35,36,255,38,39,40,41,255,255,255,255,42,41,40,39,38,255,
+    255,20,21,255,255,24,255,255,255,255,29,30,31,32,33,34,35,36,37,38,255,40,41,42,43,42,41,40,39,38,37,255,
+    255,19,20,21,22,23,24,25,255,29,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,41,40,39,38,37,36,255,
+    255,18,19,20,21,22,23,24,25,255,27,28,29,30,31,255,255,255,255,38,39,40,255,42,255,255,255,38,37,36,35,255,
+    255,17,18,19,20,21,255,23,24,25,26,27,28,255,32,33,34,35,36,37,38,39,255,43,255,255,38,37,36,35,34,255,
+    255,16,17,18,19,20,21,22,23,24,255,255,29,30,31,32,33,34,35,36,37,255,255,44,45,255,37,36,35,34,33,255,
+    255,15,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,34,33,32,255,
+    255,14,13,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,34,33,32,31,255,
+    255,13,12,11,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,30,255,
+    255,12,11,10,9,8,7,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,255,
+    255,11,10,9,8,7,6,5,6,7,8,9,10,11,12,13,14,15,255,19,18,19,20,21,255,255,255,25,26,27,28,255,
+    255,10,255,8,7,6,5,4,5,6,7,8,9,10,11,12,13,255,255,255,17,18,19,20,255,255,255,24,25,26,27,255,
+    255,9,8,7,255,5,4,3,4,5,6,255,255,255,255,11,12,13,255,15,16,17,18,19,255,255,255,23,24,25,26,255,
+    255,8,7,6,255,4,3,2,255,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,255,
+    255,7,6,5,4,3,2,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,255,
+    255,6,5,4,3,2,1,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  },
+  {
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,26,25,24,23,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,37,36,35,34,35,36,37,36,35,255,
+    255,25,24,23,22,21,22,23,24,25,26,27,28,29,30,31,32,255,36,37,38,37,36,35,34,33,34,35,255,35,34,255,
+    255,24,23,22,21,20,21,22,23,24,25,26,27,28,29,30,31,255,37,255,255,36,35,255,255,32,255,255,255,255,33,255,
+    255,23,22,21,20,19,255,255,255,255,255,27,28,29,30,31,32,255,38,37,36,35,34,33,32,31,30,29,30,31,32,255,
+    255,22,21,20,19,18,17,16,15,14,13,255,29,30,31,32,33,255,39,38,37,255,33,32,31,30,29,28,255,30,31,255,
+    255,21,255,19,18,17,16,15,14,13,12,11,255,255,255,33,34,255,255,39,38,39,255,255,255,255,255,27,28,29,30,255,
+    255,20,19,255,17,16,15,14,13,12,11,10,11,12,255,255,255,255,255,255,255,255,255,255,255,255,255,26,27,28,29,255,
+    255,19,18,17,255,15,14,13,12,11,10,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,255,
+    255,18,17,16,15,14,13,12,11,10,9,8,9,10,11,255,15,14,15,16,17,18,19,20,21,22,23,24,25,26,27,255,
+    255,17,16,15,14,13,12,11,10,9,8,7,255,255,255,11,255,13,14,255,16,17,18,19,20,21,22,23,24,25,26,255,
+    255,16,255,255,13,12,11,10,9,8,7,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,255,255,255,255,25,255,
+    255,15,14,13,12,11,10,9,8,7,255,5,6,7,8,9,10,11,12,13,14,255,18,19,20,255,20,21,22,23,24,255,
+    255,14,13,12,11,10,11,10,255,6,5,4,5,255,7,8,9,255,11,12,13,14,255,255,255,255,19,20,21,22,23,255,
+    255,13,12,255,255,9,255,255,255,255,4,3,4,5,6,7,8,9,10,11,255,13,14,15,16,17,18,19,20,21,22,255,
+    255,12,11,10,9,8,7,6,255,4,3,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,255,
+    255,11,10,9,8,7,6,5,4,255,2,1,2,3,4,255,255,255,255,11,12,13,255,15,255,255,255,19,20,21,22,255,
+    255,12,11,10,9,8,255,4,3,2,1,0,1,255,5,6,7,8,9,10,11,12,255,16,255,255,21,20,21,22,23,255,
+    255,11,10,9,8,7,6,5,4,3,255,255,2,3,4,5,6,7,8,9,10,255,255,17,18,255,22,21,22,23,24,255,
+    255,12,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,23,24,25,255,
+    255,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,31,30,29,28,27,26,25,24,25,26,255,
+    255,14,15,16,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,27,255,
+    255,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,35,34,33,32,31,30,29,28,255,
+    255,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,255,34,35,36,37,36,255,255,255,32,31,30,29,255,
+    255,17,255,19,20,21,22,23,24,25,26,27,28,29,30,31,32,255,255,255,36,37,38,37,255,255,255,33,32,31,30,255,
+    255,18,19,20,255,22,23,24,25,26,27,255,255,255,255,32,33,34,255,38,37,38,39,38,255,255,255,34,33,32,31,255,
+    255,19,20,21,255,23,24,25,255,27,28,29,30,31,32,33,34,35,36,37,38,39,40,39,38,37,36,35,34,33,32,255,
+    255,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,40,39,38,37,36,35,34,33,255,
+    255,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,41,40,39,38,37,36,35,34,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  },
+};
@@ -0,0 +1,52 @@
+/*
+============================================================
+Landmark Heuristic - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#ifndef LANDMARKS_H
+#define LANDMARKS_H
+
+#include "neslib.h"
+#include "grid.h"
+#include <inttypes.h>
+
+/*
+  BFS distances from a few landmark cells of area to every cell,
+  precomputed by tools/landmarks.c into landmark_data.c (ROM). For
+  any two cells n and goal, |d(L, goal) - d(L, n)| <= d(n, goal),
+  which gives A* a lower bound that sees walls.
+*/
+#define LANDMARK_COUNT  4
+#define LANDMARK_CELLS  GRID_CELLS
+
+/*
+  Unreachable: gives no bound. Reachable distances are clamped at
+  LANDMARK_FAR - 1, which keeps the bound consistent.
+*/
+#define LANDMARK_FAR    0xFF
+
+extern const uint8_t landmark_x[LANDMARK_COUNT];
+extern const uint8_t landmark_y[LANDMARK_COUNT];
+extern const uint8_t landmark_dist[LANDMARK_COUNT][LANDMARK_CELLS];
+
+#endif // landmarks.h
@@ -0,0 +1,242 @@
+/*
+============================================================
+Real-time Search (LRTA*) - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#include "lrta.h"
+#include <string.h>
+
+#if LRTA_DEPTH < 1 || LRTA_DEPTH > 6
+#error "LRTA_DEPTH must be in [1..6]"
+#endif
+
+/* Learned h not set yet (the Manhattan distance applies) */
+#define H_UNKNOWN       0xFFFF
+
+/* No leaf found beyond a cell: every walk from it dead-ends */
+#define COST_NONE       0xFFFF
+
+/* h stays admissible: this much proves the goal unreachable */
+#define H_FAR           GRID_CELLS
+
+#define DIR_NONE        0xFF
+
+/* Reverse of each direction */
+static const uint8_t dir_back[4] = {1, 0, 3, 2};
+
+/* Hot state lives in the zero page */
+#pragma bss-name (push, "ZEROPAGE")
+static SOLVER_LOCAL uint8_t   x, y;
+static SOLVER_LOCAL uint8_t   level, dir;
+static SOLVER_LOCAL uint16_t  cell;
+static SOLVER_LOCAL uint16_t  h, value;
+#pragma bss-name (pop)
+
+/*
+  Lookahead walk, one entry per level (the agent is level 0): cell,
+  next direction to try, direction back to the parent (never tried:
+  walks do not turn back on themselves) and best value so far.
+*/
+static SOLVER_LOCAL uint8_t   walk_x[LRTA_DEPTH + 1];
+static SOLVER_LOCAL uint8_t   walk_y[LRTA_DEPTH + 1];
+static SOLVER_LOCAL uint8_t   walk_dir[LRTA_DEPTH + 1];
+static SOLVER_LOCAL uint8_t   walk_back[LRTA_DEPTH + 1];
+static SOLVER_LOCAL uint16_t  walk_best[LRTA_DEPTH + 1];
+
+static SOLVER_LOCAL uint8_t   destX, destY;
+static SOLVER_LOCAL bool      learned;  /* The table is about destX, destY */
+static SOLVER_LOCAL uint8_t   first, best_dir;
+static SOLVER_LOCAL uint16_t  best_value;
+static SOLVER_LOCAL int16_t   num_nodes;
+
+SOLVER_LOCAL uint8_t          lrta_x, lrta_y;
+SOLVER_LOCAL uint8_t          lrta_status;
+SOLVER_LOCAL uint16_t         lrta_expanded;
+
+#define IN_BOUNDS_X(x_) ((x_) < GRID_SIZE_X)
+#define IN_BOUNDS_Y(y_) ((y_) < GRID_SIZE_Y)
+
+/* Learned h of (x, y), or its Manhattan distance to the goal */
+static void get_h(void) {
+  cell = GRID_INDEX(x, y);
+  h = lrta_h_lo[cell] | (lrta_h_hi[cell] << 8);
+  if (h == H_UNKNOWN) h = ABS_DIFF(x, destX) + ABS_DIFF(y, destY);
+}
+
+/*
+  Distance bound from the walk's level 1 cell, set up by the caller:
+  the goal is 0, cells LRTA_DEPTH steps from the agent are their h,
+  others are 1 + the best of their cells ahead, but never less than
+  their own h, so that what was learned about them counts too.
+  Walks into dead ends are worth nothing (COST_NONE).
+*/
+static uint16_t lookahead(void) {
+  level = 1;
+
+enter:
+  if (++lrta_expanded == 0) --lrta_expanded;
+  x = walk_x[level];
+  y = walk_y[level];
+  if (x == destX && y == destY) {
+    value = 0;
+    goto up;
+  }
+  if (level == LRTA_DEPTH) {
+    get_h();
+    value = h;
+    goto up;
+  }
+  walk_dir[level] = 0;
+  walk_best[level] = COST_NONE;
+
+next:
+  while ((dir = walk_dir[level]) < 4) {
+    ++walk_dir[level];
+    if (dir == walk_back[level]) continue;
+    x = walk_x[level] + grid_dx[dir];
+    y = walk_y[level] + grid_dy[dir];
+    if (!IN_BOUNDS_X(x) || !IN_BOUNDS_Y(y) || GRID_SOLID(x, y)) continue;
+    ++level;
+    walk_x[level] = x;
+    walk_y[level] = y;
+    walk_back[level] = dir_back[dir];
+    goto enter;
+  }
+
+  /* All cells ahead done */
+  value = walk_best[level];
+  if (value != COST_NONE) {
+    x = walk_x[level];
+    y = walk_y[level];
+    get_h();
+    if (value < h) value = h;
+  }
+
+up:
+  if (level == 1) return value;
+  --level;
+  if (value != COST_NONE && value + 1 < walk_best[level]) {
+    walk_best[level] = value + 1;
+  }
+  goto next;
+}
+
+void __fastcall__ lrta_reset(void) {
+  wram_owner = WRAM_OWNER_LRTA;
+  memset(lrta_h_lo, 0xFF, GRID_CELLS);
+  memset(lrta_h_hi, 0xFF, GRID_CELLS);
+}
+
+void __fastcall__ initialize_lrta_solver(void) {
+  lrta_reset();
+  learned = FALSE;
+  lrta_status = LRTA_NO_PATH;
+}
+
+bool __fastcall__ lrta_begin(uint8_t sx, uint8_t sy, uint8_t dx, uint8_t dy) {
+  lrta_status = LRTA_NO_PATH;
+  lrta_expanded = 0;
+  num_nodes = 0;
+  if (sx == dx && sy == dy) return FALSE;
+  if (!IN_BOUNDS_X(sx) || !IN_BOUNDS_X(dx) || !IN_BOUNDS_Y(sy) || !IN_BOUNDS_Y(dy)) return FALSE;
+  if (GRID_SOLID(sx, sy) || GRID_SOLID(dx, dy)) return FALSE;
+
+  /* What was learned only holds for the same goal, if still there */
+  if (!learned || wram_owner != WRAM_OWNER_LRTA || dx != destX || dy != destY) {
+    lrta_reset();
+    destX = dx;
+    destY = dy;
+    learned = TRUE;
+  }
+
+  lrta_x = sx;
+  lrta_y = sy;
+  waypointX[0] = sx;
+  waypointY[0] = sy;
+  num_nodes = 1;
+  lrta_status = LRTA_MOVING;
+  return TRUE;
+}
+
+int16_t __fastcall__ lrta_step(void) {
+  if (lrta_status != LRTA_MOVING) return num_nodes;
+
+  /* Best first step, by the lookahead beyond it */
+  best_dir = DIR_NONE;
+  best_value = COST_NONE;
+  for (first = 0; first < 4; ++first) {
+    x = lrta_x + grid_dx[first];
+    y = lrta_y + grid_dy[first];
+    if (!IN_BOUNDS_X(x) || !IN_BOUNDS_Y(y) || GRID_SOLID(x, y)) continue;
+    walk_x[1] = x;
+    walk_y[1] = y;
+    walk_back[1] = dir_back[first];
+    if (lookahead() != COST_NONE && value + 1 < best_value) {
+      best_value = value + 1;
+      best_dir = first;
+    }
+  }
+
+  /*
+    No leaf at all: every walk dead-ends within the lookahead, so
+    the agent's whole region is in view and the goal is not in it.
+  */
+  if (best_dir == DIR_NONE) {
+    lrta_status = LRTA_NO_PATH;
+    return num_nodes;
+  }
+
+  /* Learn: the cell left is at least best_value from the goal */
+  x = lrta_x;
+  y = lrta_y;
+  get_h();
+  if (best_value > h) {
+    lrta_h_lo[cell] = (uint8_t)best_value;
+    lrta_h_hi[cell] = (uint8_t)(best_value >> 8);
+  }
+  if (best_value >= H_FAR) {
+    lrta_status = LRTA_NO_PATH;
+    return num_nodes;
+  }
+
+  /* Move */
+  lrta_x += grid_dx[best_dir];
+  lrta_y += grid_dy[best_dir];
+  waypointX[num_nodes] = lrta_x;
+  waypointY[num_nodes] = lrta_y;
+  ++num_nodes;
+  if (lrta_x == destX && lrta_y == destY) {
+    lrta_status = LRTA_ARRIVED;
+  } else if (num_nodes == WAYPOINT_COUNT) {
+    lrta_status = LRTA_TOO_LONG;
+  }
+  return num_nodes;
+}
+
+int16_t __fastcall__ solve_lrta(uint8_t sx, uint8_t sy, uint8_t dx, uint8_t dy) {
+  if (!lrta_begin(sx, sy, dx, dy)) return 0;
+  while (lrta_status == LRTA_MOVING) {
+    lrta_step();
+  }
+  return lrta_status == LRTA_ARRIVED ? num_nodes : 0;
+}
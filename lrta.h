@@ -0,0 +1,94 @@
+/*
+============================================================
+Real-time Search (LRTA*) - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#ifndef LRTA_H
+#define LRTA_H
+
+#include "neslib.h"
+#include "grid.h"
+#include "wram.h"
+#include <inttypes.h>
+
+/*
+  Learning real-time A*: instead of a whole path, each lrta_step()
+  looks LRTA_DEPTH steps ahead of the agent, moves it one cell and
+  raises the learned distance h of the cell it left. The work per
+  move is bounded by the lookahead, whatever the map. The first
+  trips wander; h only grows, so repeated trips to the same goal
+  settle on shortest paths.
+
+  The learned table (lrta_h_lo/hi in wram.h) shares WRAM with A*,
+  solve_nearest() and swamp_analyze(): lrta_begin() starts over on
+  its own when one of those ran since (see wram_owner). A changed
+  grid is not seen: call lrta_reset() after changing it by hand.
+  world_window() and solver_run() do that for their grids.
+*/
+
+/* Lookahead depth in steps: at most 4 * 3^(depth - 1) leaves per move */
+#ifndef LRTA_DEPTH
+#define LRTA_DEPTH      2
+#endif
+
+/* lrta_status */
+#define LRTA_MOVING     0
+#define LRTA_ARRIVED    1
+#define LRTA_NO_PATH    2   /* The goal cannot be reached */
+#define LRTA_TOO_LONG   3   /* The trip filled the waypoints */
+
+/* Agent cell and trip state */
+extern SOLVER_LOCAL uint8_t lrta_x, lrta_y;
+extern SOLVER_LOCAL uint8_t lrta_status;
+
+/* Cells looked at by the lookahead since lrta_begin() */
+extern SOLVER_LOCAL uint16_t lrta_expanded;
+
+void __fastcall__ initialize_lrta_solver(void);
+
+/* Forgets everything learned */
+void __fastcall__ lrta_reset(void);
+
+/*
+  Starts a trip from (sx, sy) to (dx, dy). What was learned is kept
+  if the goal is the same as last time and nothing else used the
+  table since. FALSE if the request is
+  invalid (off the grid, solid, or already there).
+*/
+bool __fastcall__ lrta_begin(uint8_t sx, uint8_t sy, uint8_t dx, uint8_t dy);
+
+/*
+  Moves the agent one cell while lrta_status is LRTA_MOVING. The
+  trip so far, loops included, is in waypointX/waypointY: returns
+  its node count.
+*/
+int16_t __fastcall__ lrta_step(void);
+
+/*
+  Whole trip in one call, for the SOLVER interface: returns the
+  node count of the trip (0 = no path or too long). Calls to the
+  same goal keep learning, so trips get shorter.
+*/
+int16_t __fastcall__ solve_lrta(uint8_t sx, uint8_t sy, uint8_t dx, uint8_t dy);
+
+#endif // lrta.h
@@ -24,7 +24,20 @@ Under the following terms:
 ============================================================
 */
 
-#define SOLVER astar  /* or dfs */
+#define SOLVER astar  /* or dfs, idastar, pathdb, lrta, subgoal */
+
+#define ASTAR_WEIGHT  ASTAR_WEIGHT_ONE  /* 6 = paths up to 1.5x the shortest */
+#define ASTAR_TIE     ASTAR_TIE_HIGH_G  /* or ASTAR_TIE_FIRST, ASTAR_TIE_LINE */
+#define ASTAR_LANDMARKS /* landmark heuristic (area only, not world windows) */
+
+#define SWAMP_PRUNING   /* solvers skip dead ends and one-door rooms */
+
+//#define PROFILE       /* tint the screen per subsystem, show lag frames */
+//#define TELEMETRY     /* log every solve to WRAM (see tools/telemetry.c) */
+//#define BENCHMARK     /* replay bench.c's queries instead of reading the pad */
+
+//#define CROWD_MODE    /* every solve spawns agents instead of one follower */
+#define CROWD_SPAWN   4 /* agents per solved path */
 
 #define CAT(a,b) a##b
 #define XCAT(a,b) CAT(a,b)
@@ -35,6 +48,14 @@ Under the following terms:
 #define INIT_SOLVER() \
     XCAT(initialize_, XCAT(SOLVER, _solver))()
 
+#ifdef TELEMETRY
+#define TELEMETRY_LOG(sx_, sy_, dx_, dy_, nodes_, frames_) \
+    telemetry_log(XCAT(TELEMETRY_, SOLVER), sx_, sy_, dx_, dy_, \
+                  nodes_, XCAT(SOLVER, _expanded), frames_)
+#else
+#define TELEMETRY_LOG(sx_, sy_, dx_, dy_, nodes_, frames_)
+#endif
+
 #include "neslib.h"
 
 #include "vrambuf.h"
@@ -43,15 +64,74 @@ Under the following terms:
 #include "area.h"
 //#link "area.c"
 
+#include "grid.h"
+//#link "grid.c"
+
+// WORLD_MODE (in world.h) scrolls over the packed world (maps/world.txt)
+#include "world.h"
+//#link "world.c"
+//#link "world_data.c"
+
+#if defined(WORLD_MODE) && (GRID_SIZE_X > WORLD_SCREEN_X || GRID_SIZE_Y > WORLD_SCREEN_Y)
+#error "WORLD_MODE windows are at most one screen"
+#endif
+
+#if defined(CROWD_MODE) && defined(WORLD_MODE)
+#error "CROWD_MODE agents are limited to a single screen"
+#endif
+
+#if defined(BENCHMARK) && (defined(CROWD_MODE) || defined(WORLD_MODE))
+#error "BENCHMARK replays its queries over area, with one follower"
+#endif
+
 #include "dfs.h"
 //#link "dfs.c"
 
 #include "astar.h"
 //#link "astar.c"
 
+// SOLVER idastar also needs idastar.c
+#include "idastar.h"
+
+// solve_nearest() needs nearest.c
+#include "nearest.h"
+
+// SOLVER lrta also needs lrta.c
+#include "lrta.h"
+
+// SOLVER subgoal also needs subgoal.c and subgoal_data.c
+#include "subgoal.h"
+
+#include "landmarks.h"
+//#link "landmark_data.c"
+
+#include "swamp.h"
+//#link "swamp.c"
+
+// SOLVER pathdb also needs pathdb.c and pathdb_data.c (see README.md)
+#include "pathdb.h"
+
+#include "vis.h"
+//#link "vis.c"
+
+// TELEMETRY also needs telemetry.c
+#include "telemetry.h"
+
+// BENCHMARK also needs bench.c
+#include "bench.h"
+
+// solver_run() contexts need solver.c, idastar.c and lrta.c (see README.md)
+#include "solver.h"
+
 #include "cursor.h"
 //#link "cursor.c"
 
+// CROWD_MODE also needs crowd.c
+#include "crowd.h"
+
+// PROFILE also needs profile.c
+#include "profile.h"
+
 //#link "chr_generic.s"
 
 /*{pal:"nes",layout:"nes"}*/
@@ -74,44 +154,128 @@ static uint8_t sprid;
 static uint16_t wp_i, wp;
 static uint8_t  x, y, sprite;
 
-static uint8_t px, py;
+static uint16_t px, py;
 static int8_t  vx, vy;
 
 static uint8_t sx, sy, dx, dy;
+#ifdef WORLD_MODE
+static uint8_t world_status;
+#endif
 
 static byte pad;
 
+#ifdef CROWD_MODE
+static uint8_t path, agent;
+#endif
+
 static uint8_t framecount;
 
+#ifdef TELEMETRY
+static uint8_t solve_clock;
+#endif
+
+#ifdef WORLD_MODE
+#define MAP_ADR(x_, y_) world_ntadr(x_, y_)
+#else
+#define MAP_ADR(x_, y_) NTADR_A(x_, y_)
+#endif
+
+// add a sprite at a map pixel position, if it is on screen
+void put_spr(uint16_t spx, uint16_t spy, char tile, byte attr) {
+  spx -= camera.x;
+  spy -= camera.y;
+  if (spx < 256 && spy < 240) {
+    sprid = oam_spr(spx, spy - 1, tile, attr, sprid);
+  }
+}
+
 void put_msg(char *msg, int8_t size) {  
   vrambuf_put(NTADR_A(3, 2), msg, size);
   ppu_wait_nmi();  
 }
 
 void draw_map(void) {
-  for (y = 0; y < 30; ++y) {
-    for (x = 0; x < 32; ++x) {
+#ifdef WORLD_MODE
+  world_draw();
+#else
+  for (y = 0; y < GRID_SIZE_Y; ++y) {
+    for (x = 0; x < GRID_SIZE_X; ++x) {
       vram_adr(NTADR_A(x, y));
       vram_write(&area[y][x], 1);
     }
   }
+#endif
 }
 
 void draw_path(void) {
   if (!wp) {
+#ifdef WORLD_MODE
+    // the search only sees one window of the world
+    if (world_status == WORLD_OUT_OF_RANGE) {
+      put_msg("Too far apart", 13);
+    } else {
+      put_msg("No path in window", 17);
+    }
+#else
     put_msg("No solution", 11);
+#endif
   }
   else {
     vrambuf_clear();
   }
   for (wp_i = 0; wp_i < wp; ++wp_i) {    
-    x = waypointX[wp_i];
-    y = waypointY[wp_i];   
-    vram_adr(NTADR_A(x, y));
+    x = waypointX[wp_i] + world_origin_x;
+    y = waypointY[wp_i] + world_origin_y;
+    vram_adr(MAP_ADR(x, y));
     vram_write("+", 1);   
   }
 }
 
+#ifdef BENCHMARK
+// solve the benchmark script forever, showing each path and then
+// the results (see bench.h)
+void run_benchmark(void) {
+  static uint8_t query;
+
+  bench_init(XCAT(TELEMETRY_, SOLVER));
+  while (1) {
+    vrambuf_clear();
+    bench_begin();
+    for (query = 0; query < BENCH_QUERIES; ++query) {
+      sx = bench_script[query].sx;
+      sy = bench_script[query].sy;
+      dx = bench_script[query].dx;
+      dy = bench_script[query].dy;
+      // keep the NMI as short as during calibration
+      vrambuf_clear();
+      bench_start();
+      wp = SOLVE(sx, sy, dx, dy);
+      bench_stop(query, wp, XCAT(SOLVER, _expanded));
+#ifdef SEARCH_VIS
+      // the timings include painting the search
+      vis_flush();
+      ppu_off();
+#else
+      ppu_off();
+      draw_map();
+#endif
+      draw_path();
+      ppu_on_all();
+      delay(BENCH_SHOW);
+    }
+    bench_end();
+    vrambuf_clear();
+    ppu_off();
+    bench_draw();
+    ppu_on_all();
+    delay(BENCH_HOLD);
+    ppu_off();
+    draw_map();
+    ppu_on_all();
+  }
+}
+#endif
+
 void main(void) {
   
   sx = 0;
@@ -136,18 +300,38 @@ void main(void) {
   cursor.state = ON;
   
   // Init
+  grid_load_area();
+#ifdef SWAMP_PRUNING
+  swamp_analyze();
+#endif
   INIT_SOLVER();
+  astar_set_mode(ASTAR_WEIGHT, ASTAR_TIE);
+#ifdef ASTAR_LANDMARKS
+  astar_set_landmarks(&landmark_dist[0][0], LANDMARK_COUNT);
+#endif
+#ifdef CROWD_MODE
+  crowd_init();
+#endif
+#ifdef TELEMETRY
+  telemetry_init();
+#endif
   
   // Enable PPU rendering (turn on screen)
   ppu_on_all();
 
+#ifdef BENCHMARK
+  run_benchmark();
+#endif
+
   // infinite loop  
   while (1) {     
     //oam_clear();
     sprid = 0;
     
     if (cursor.state == ON) { 
+      PROFILE_BEGIN(PROFILE_INPUT);
       pad = pad_trigger(0);
+      PROFILE_END();
       if (pad & PAD_A) {
         if ((!sx && !sy) || (dx && dy)) {
           wp = 0;
@@ -167,14 +351,48 @@ void main(void) {
           // - - - - -
           dx = cursor.mx;
           dy = cursor.my;          
+          PROFILE_BEGIN(PROFILE_SOLVE);
+#ifdef TELEMETRY
+          solve_clock = nesclock();
+#endif
+#ifdef WORLD_MODE
+          // search the window of the world around both points
+          wp = 0;
+          world_status = world_window(sx, sy, dx, dy);
+          if (world_status == WORLD_OK) {
+            wp = SOLVE(sx - world_origin_x, sy - world_origin_y,
+                       dx - world_origin_x, dy - world_origin_y);
+          }
+#else
           wp = SOLVE(sx, sy, dx, dy);          
+#endif
+          TELEMETRY_LOG(sx, sy, dx, dy, wp, nesclock() - solve_clock);
+          PROFILE_END();
+#ifdef SEARCH_VIS
+          // paint the rest of the search, and keep it under the path
+          vis_flush();
+          ppu_off();
+          vrambuf_clear();
+#else
           ppu_off();
           vrambuf_clear();
           draw_map();
+#endif
           draw_path();          
           ppu_on_all();
           sprite = 0x18;
           wp_i = 0;
+#ifdef CROWD_MODE
+          // hand the path over to a group of agents
+          path = crowd_store_path(wp);
+          if (path == CROWD_NONE) {
+            put_msg("No room for path", 16);
+          }
+          for (agent = 0; agent < CROWD_SPAWN; ++agent) {
+            crowd_spawn(path, agent * 16);
+          }
+          wp = 0;
+#endif
         }
       }
       if (pad & PAD_B) {
@@ -183,17 +401,34 @@ void main(void) {
         sy = NULL;
         dx = NULL;
         dy = NULL;
+#ifdef CROWD_MODE
+        crowd_init();
+#endif
         ppu_off();
         draw_map();
         ppu_on_all();
       }      
+      PROFILE_BEGIN(PROFILE_INPUT);
       cursor_move();    
-      sprid = oam_spr(cursor.x, cursor.y - 1, cursor.sprite, 0, sprid);
+      PROFILE_END();
+#ifdef WORLD_MODE
+      PROFILE_BEGIN(PROFILE_VRAM);
+      world_follow(cursor.x, cursor.y);
+      world_scroll();
+      PROFILE_END();
+#endif
+      put_spr(cursor.x, cursor.y, cursor.sprite, 0);
     }
     
+    PROFILE_BEGIN(PROFILE_SPRITES);
+#ifdef CROWD_MODE
+    crowd_update();
+    sprid = crowd_draw(sprid);
+#endif
+
     if (wp) {
-      x = waypointX[wp_i];
-      y = waypointY[wp_i];
+      x = waypointX[wp_i] + world_origin_x;
+      y = waypointY[wp_i] + world_origin_y;
             
       vx = 0;      
       if (px != x * 8) vx = (px > x * 8) ? -1 : 1;
@@ -206,7 +441,7 @@ void main(void) {
       
       //sprid = oam_spr(x*8, y*8-1, 0x18, 0, sprid);            
         
-      sprid = oam_spr(px, py-1, sprite, 0, sprid);
+      put_spr(px, py, sprite, 0);
       if (++framecount == 16) {
         framecount = 0;
         if (++sprite > 0x18 + 2) {          
@@ -219,12 +454,18 @@ void main(void) {
       }
     }
     if (sx && sy) {
-      sprid = oam_spr(sx*8, sy*8 - 1, 'S', 3, sprid);
+      put_spr(sx*8, sy*8, 'S', 3);
     }
     if (dx && dy) {
-      sprid = oam_spr(dx*8, dy*8 - 1, 'F', 3, sprid);
+      put_spr(dx*8, dy*8, 'F', 3);
     }
-    ppu_wait_nmi();
+    PROFILE_DRAW(sprid);
+    PROFILE_END();
+    PROFILE_WAIT_NMI();
+#ifdef WORLD_MODE
+    // streamed tiles are written once
+    vrambuf_clear();
+#endif
     oam_clear();
   }
 }
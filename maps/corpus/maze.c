@@ -0,0 +1,47 @@
+/* Generated by tools/mapgen.c: maze 0, seed 1 -- do not edit */
+const char area[30][32] = {
+  {"XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX"},
+  {"X X         X     X           XX"},
+  {"X X X XXX XXX XXX X XXXXX XXXXXX"},
+  {"X X X   X X   X   X X   X X   XX"},
+  {"X X XXX XXX XXX XXX X X X X X XX"},
+  {"X X   X       X X   X X X   X XX"},
+  {"X X XXXXXXXXXXX X XXX XXXXXXX XX"},
+  {"X X X         X X     X     X XX"},
+  {"X X X XXXXXXX X XXXXX X XXX X XX"},
+  {"X X X     X X X     X X X     XX"},
+  {"X XXXXXXX X X X XXXXX X XXXXXXXX"},
+  {"X   X     X X X X     X       XX"},
+  {"XXX X XXXXX X X X XXXXXXXXXXX XX"},
+  {"X X   X   X   X       X       XX"},
+  {"X XXXXX XXX XXXXXXXXX X XXXXX XX"},
+  {"X       X   X       X X   X   XX"},
+  {"X XXX XXX XXXXX XXX XXXXX XXXXXX"},
+  {"X   X     X     X X     X     XX"},
+  {"XXX XXXXXXXXX XXX XXXXX X XXX XX"},
+  {"X   X       X X   X   X X   X XX"},
+  {"X XXX X XXX X X XXX X X XXX X XX"},
+  {"X   X X   X   X X   X   X   X XX"},
+  {"XXX XXXXX XXXXX X XXXXXXXXXXX XX"},
+  {"X X     X X       X   X   X   XX"},
+  {"X XXXXX X X XXXXXXX X X X X XXXX"},
+  {"X     X   X X       X X X X   XX"},
+  {"X XXX XXXXX X XXXXXXX X X XXX XX"},
+  {"X   X         X         X     XX"},
+  {"XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX"},
+  {"XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX"}
+};
+
+#include "bench.h"
+
+#ifdef BENCH_AREA_SCRIPT
+const BenchQuery bench_script[BENCH_QUERIES] = {
+  { 7,  4,  7,  5},   /* 1 step */
+  {27, 25, 15, 25},   /* 32 steps */
+  { 1, 20, 17, 23},   /* 63 steps */
+  { 8, 17, 15, 25},   /* 97 steps */
+  { 4,  5, 29, 26},   /* 136 steps */
+  {28,  3, 11, 15},   /* 187 steps */
+  { 1,  1,  3,  9},   /* 318 steps */
+};
+#endif
@@ -0,0 +1,47 @@
+/* Generated by tools/mapgen.c: maze 10, seed 1 -- do not edit */
+const char area[30][32] = {
+  {"XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX"},
+  {"X X         X     X           XX"},
+  {"X X X XXX XXX X X X XXXXX XXXXXX"},
+  {"X X X   X X       X X   X X   XX"},
+  {"X X XXX XXX XXX XXX X X X X X XX"},
+  {"X X   X       X X   X X X   X XX"},
+  {"X X XXX XXXXXXX X X X XXXXXXX XX"},
+  {"X X X         X X     X     X XX"},
+  {"X X X XXXXXXX X XXXXX X XXX X XX"},
+  {"X X X     X X X     X X X     XX"},
+  {"X XXXXXXX X X X XX XX X XXXXXXXX"},
+  {"X   X     X X X X     X       XX"},
+  {"XXX X XXXXX X X X XXXXXXX XXX XX"},
+  {"X X       X   X       X       XX"},
+  {"X XXXXX XXX XXXX XXXX X XXXXX XX"},
+  {"X       X   X       X X   X   XX"},
+  {"X XXX XXX XXXXX XXX XXXXX XXXXXX"},
+  {"X         X     X X     X     XX"},
+  {"XXX X XXXXXXX XXX XXXXX X XXX XX"},
+  {"X             X   X   X     X XX"},
+  {"X XXX X XXX X X XXX X X X X X XX"},
+  {"X   X X   X   X         X   X XX"},
+  {"XXX XXXXX X XXX X X XXXXXXXXX XX"},
+  {"X X               X   X   X   XX"},
+  {"X XX XX X X XXXXXXX X X X X XXXX"},
+  {"X     X     X       X X X X   XX"},
+  {"X XXX XXXXX X XXX XXX X X XXX XX"},
+  {"X   X         X         X     XX"},
+  {"XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX"},
+  {"XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX"}
+};
+
+#include "bench.h"
+
+#ifdef BENCH_AREA_SCRIPT
+const BenchQuery bench_script[BENCH_QUERIES] = {
+  { 1, 11,  2, 11},   /* 1 step */
+  {20, 17, 15,  6},   /* 16 steps */
+  { 2, 19, 19, 21},   /* 23 steps */
+  {24, 23,  5, 23},   /* 31 steps */
+  {27, 17,  3, 27},   /* 38 steps */
+  { 2, 15, 29, 23},   /* 47 steps */
+  {25,  9,  1,  5},   /* 76 steps */
+};
+#endif
@@ -0,0 +1,47 @@
+/* Generated by tools/mapgen.c: random 10, seed 1 -- do not edit */
+const char area[30][32] = {
+  {"XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX"},
+  {"X     X                        X"},
+  {"XX    X        X   X           X"},
+  {"X XX                  X  X     X"},
+  {"X  X        X                  X"},
+  {"X                    X  X    X X"},
+  {"X                   X         XX"},
+  {"X     X        X  X          X X"},
+  {"X            X                XX"},
+  {"X                              X"},
+  {"X       X      X  X X          X"},
+  {"X                              X"},
+  {"X                X X           X"},
+  {"X                      X     X X"},
+  {"X               X              X"},
+  {"X        XX X               X  X"},
+  {"X      X    X               XX X"},
+  {"X  X               X X       XXX"},
+  {"X           X     XX          XX"},
+  {"XX      X                   X  X"},
+  {"X   X         X  X  X          X"},
+  {"X  X   X X X   X      X   X    X"},
+  {"X                          X   X"},
+  {"X            X        X    X   X"},
+  {"X      X             X         X"},
+  {"X    X                 X       X"},
+  {"X            XX    X     X     X"},
+  {"X                              X"},
+  {"X                              X"},
+  {"XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX"}
+};
+
+#include "bench.h"
+
+#ifdef BENCH_AREA_SCRIPT
+const BenchQuery bench_script[BENCH_QUERIES] = {
+  { 7, 11,  6, 11},   /* 1 step */
+  {18, 17, 19,  7},   /* 11 steps */
+  {14,  2, 28,  4},   /* 16 steps */
+  { 2,  5, 14, 15},   /* 22 steps */
+  {29, 24, 17,  8},   /* 28 steps */
+  { 1,  1, 30, 27},   /* 55 steps */
+  {30,  7, 28,  8},   /* Unreachable */
+};
+#endif
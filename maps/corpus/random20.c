@@ -0,0 +1,47 @@
+/* Generated by tools/mapgen.c: random 20, seed 1 -- do not edit */
+const char area[30][32] = {
+  {"XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX"},
+  {"X     X X        X  XX   X  X  X"},
+  {"XX    X  X     X   X           X"},
+  {"X XX                  X  X     X"},
+  {"X  X        XX              X XX"},
+  {"X     X              X XX   XX X"},
+  {"X     X             X  X      XX"},
+  {"X X X X X  X   X  X  X       X X"},
+  {"X   X   X  X X                XX"},
+  {"X                  X       XX  X"},
+  {"X   X   X  XX  XX X X          X"},
+  {"X             X      X X       X"},
+  {"XX               X X           X"},
+  {"X   X             X X  XX    X X"},
+  {"X     X       X X   X       X XX"},
+  {"X        XX XX    X       X X  X"},
+  {"X      X    X   X           XX X"},
+  {"X XX               X X       XXX"},
+  {"X    XX     X X   XX X    X   XX"},
+  {"XX  X   X X           XX    X  X"},
+  {"X XXX         X  X  X          X"},
+  {"X  XX  X X XX  X X    XX  X    X"},
+  {"X      XX        X   X     X   X"},
+  {"X    X       X        XX   X   X"},
+  {"X      X X     XXX X X         X"},
+  {"XX  XXXX X             X   X   X"},
+  {"X     X X    XX  X X     X     X"},
+  {"X    X                      X  X"},
+  {"X   X      X   X       X       X"},
+  {"XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX"}
+};
+
+#include "bench.h"
+
+#ifdef BENCH_AREA_SCRIPT
+const BenchQuery bench_script[BENCH_QUERIES] = {
+  {14, 16, 14, 17},   /* 1 step */
+  { 8, 13, 17, 11},   /* 11 steps */
+  {15, 26,  2, 22},   /* 17 steps */
+  {13, 16, 24, 28},   /* 23 steps */
+  {14,  9, 28, 24},   /* 29 steps */
+  {30,  2,  1, 28},   /* 55 steps */
+  {28, 11, 30,  7},   /* Unreachable */
+};
+#endif
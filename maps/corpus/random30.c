@@ -0,0 +1,47 @@
+/* Generated by tools/mapgen.c: random 30, seed 1 -- do not edit */
+const char area[30][32] = {
+  {"XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX"},
+  {"X     X XX       XXXXX   X XX XX"},
+  {"XX    X  X     X   X     X   X X"},
+  {"X XX X   X  XX   X   XX  X X   X"},
+  {"X XX    X  XXX              X XX"},
+  {"XX    X X            X XX   XX X"},
+  {"X XX  X   X   XX    X  X      XX"},
+  {"X X X X X  X   X  X  X       X X"},
+  {"X   X   X  X X     X X X     XXX"},
+  {"X   X              XX   XX XX  X"},
+  {"X   X   X  XXX XX X X X     X XX"},
+  {"X  X      X   X      X X       X"},
+  {"XX             XXXXX           X"},
+  {"X   XX            X X  XX    XXX"},
+  {"X XX  X     X X X   X  X X  X XX"},
+  {"X   X    XXXXXX X XXX     X X  X"},
+  {"XX XX  X    X   X        X  XX X"},
+  {"X XX        X    XXX X     X XXX"},
+  {"X    XX    XX X   XX X    X   XX"},
+  {"XX XX   X X    X     XXX    X  X"},
+  {"X XXX         X  XX X    X    XX"},
+  {"X  XX  X X XX  X X  X XX  X    X"},
+  {"X   X  XX  X X   X   X X   XX XX"},
+  {"X    X   X   X        XX   X   X"},
+  {"X    XXX X  X  XXX X X         X"},
+  {"XX  XXXX X             X  XX X X"},
+  {"X     XXX    XX  X X     X     X"},
+  {"X    X                      X  X"},
+  {"X   X      X   X       X X    XX"},
+  {"XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX"}
+};
+
+#include "bench.h"
+
+#ifdef BENCH_AREA_SCRIPT
+const BenchQuery bench_script[BENCH_QUERIES] = {
+  { 7, 11,  7, 10},   /* 1 step */
+  {19, 16, 25, 23},   /* 13 steps */
+  {14, 23, 11, 11},   /* 19 steps */
+  {10, 22, 24, 16},   /* 24 steps */
+  {26,  4, 30, 27},   /* 31 steps */
+  { 4,  2, 29, 27},   /* 50 steps */
+  {27, 12,  2, 28},   /* Unreachable */
+};
+#endif
@@ -0,0 +1,47 @@
+/* Generated by tools/mapgen.c: random 40, seed 1 -- do not edit */
+const char area[30][32] = {
+  {"XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX"},
+  {"X    XX XXX      XXXXX   X XX XX"},
+  {"XX    XX X X   X   X     X   X X"},
+  {"X XX XX XXX XX XXX XXXXX X X X X"},
+  {"X XX    X  XXX  X  X    XXXXX XX"},
+  {"XX    XXX            X XX   XX X"},
+  {"XXXX  XX  X XXXX    X  X X X  XX"},
+  {"X X X X X  X   X  XXXX       X X"},
+  {"X  XX  XX XX XX    XXX X X   XXX"},
+  {"X   X  X          XXX   XX XX  X"},
+  {"X X X  XX  XXX XX X X X    XX XX"},
+  {"X XX      X X X     XX X  X    X"},
+  {"XX           XXXXXXX    X X    X"},
+  {"X   XX   X        X X  XX  X XXX"},
+  {"X XX  X X   X XXX   XX X X  X XX"},
+  {"X X X  X XXXXXX X XXX    XXXX  X"},
+  {"XX XX XXX   X   X        X  XX X"},
+  {"X XX  XX    XX  XXXX X   X X XXX"},
+  {"X    XXXX XXXXXX  XX X  X X   XX"},
+  {"XX XX   X X  X X   X XXX    XX X"},
+  {"X XXX     X   X  XX X    X    XX"},
+  {"XX XXXXX X XX  X X  X XX  XX  XX"},
+  {"XX XXXXXX  X X  XX   X X  XXX XX"},
+  {"XX   X   X  XX      X XXX  X   X"},
+  {"X  XXXXX X  X  XXX X XX        X"},
+  {"XX  XXXX X        X X  X  XX X X"},
+  {"X     XXXXXX XX  X X     X     X"},
+  {"X    X         X         X  XX X"},
+  {"X   X      X   X XX  X X XX   XX"},
+  {"XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX"}
+};
+
+#include "bench.h"
+
+#ifdef BENCH_AREA_SCRIPT
+const BenchQuery bench_script[BENCH_QUERIES] = {
+  { 4,  2,  4,  3},   /* 1 step */
+  {19, 11, 12,  9},   /* 9 steps */
+  {17,  9,  4, 11},   /* 15 steps */
+  {11, 19, 22, 25},   /* 21 steps */
+  { 1, 15, 23, 18},   /* 31 steps */
+  {23, 18, 25, 13},   /* 53 steps */
+  {12, 28,  6, 13},   /* Unreachable */
+};
+#endif
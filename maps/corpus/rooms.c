@@ -0,0 +1,47 @@
+/* Generated by tools/mapgen.c: rooms 4, seed 1 -- do not edit */
+const char area[30][32] = {
+  {"XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX"},
+  {"X       X       X        X     X"},
+  {"X       X       X        X     X"},
+  {"X       X       X        X     X"},
+  {"X       X       X              X"},
+  {"X               X XXXXXXXXXXXX X"},
+  {"XXXXXX XXXXXXXXXX        X     X"},
+  {"X               X        X     X"},
+  {"X       X       X        X     X"},
+  {"X       X       X        X     X"},
+  {"X       X       X        X     X"},
+  {"X XXXXXXXXXXXXXXXXXXXX XXXXXXXXX"},
+  {"X     X    X    X    X    X    X"},
+  {"X     X    X    X    X         X"},
+  {"X          X    X    X    X    X"},
+  {"X     X    X    X    X    X    X"},
+  {"XXXXX X    X    XX XXX XXXXXXXXX"},
+  {"X     XXXX XXXX X              X"},
+  {"X     X    X         X    X    X"},
+  {"X     X    X    X    X    X    X"},
+  {"X     X         X    X    X    X"},
+  {"X     X    X    XXXXXXXXXXXX XXX"},
+  {"XXXXXXXXX XXXXXXX       X      X"},
+  {"X     X         X       X      X"},
+  {"X          X    X       X      X"},
+  {"X     X    X    X       X      X"},
+  {"X     X    X    X       X      X"},
+  {"X     X    X    X       X      X"},
+  {"X     X    X    X              X"},
+  {"XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX"}
+};
+
+#include "bench.h"
+
+#ifdef BENCH_AREA_SCRIPT
+const BenchQuery bench_script[BENCH_QUERIES] = {
+  { 1, 11,  1, 10},   /* 1 step */
+  {15,  8,  1,  8},   /* 16 steps */
+  { 2, 24, 18, 13},   /* 27 steps */
+  {22, 10, 20, 23},   /* 37 steps */
+  {26,  4, 10, 15},   /* 47 steps */
+  {19,  7,  5,  5},   /* 58 steps */
+  {13,  4, 30, 10},   /* 89 steps */
+};
+#endif
@@ -0,0 +1,47 @@
+/* Generated by tools/mapgen.c: spiral 1, seed 1 -- do not edit */
+const char area[30][32] = {
+  {"XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX"},
+  {"X                              X"},
+  {"X X XXXXXXXXXXXXXXXXXXXXXXXXXX X"},
+  {"X X                          X X"},
+  {"X X XXXXXXXXXXXXXXXXXXXXXXXX X X"},
+  {"X X X                      X X X"},
+  {"X X X X XXXXXXXXXXXXXXXXXX X X X"},
+  {"X X X X                  X X X X"},
+  {"X X X X XXXXXXXXXXXXXXXX X X X X"},
+  {"X X X X X              X X X X X"},
+  {"X X X X X X XXXXXXXXXX X X X X X"},
+  {"X X X X X X          X X X X X X"},
+  {"X X X X X X XXXXXXXX X X X X X X"},
+  {"X X X X X X X      X X X X X X X"},
+  {"X X X X X X X      X X X X X X X"},
+  {"X X X X X X X      X X X X X X X"},
+  {"X X X X X X X      X X X X X X X"},
+  {"X X X X X X XXXXXX X X X X X X X"},
+  {"X X X X X X          X X X X X X"},
+  {"X X X X X XXXXXXXXXXXX X X X X X"},
+  {"X X X X X              X X X X X"},
+  {"X X X X XXXXXXXXXXXXXX X X X X X"},
+  {"X X X X                  X X X X"},
+  {"X X X XXXXXXXXXXXXXXXXXXXX X X X"},
+  {"X X X                      X X X"},
+  {"X X XXXXXXXXXXXXXXXXXXXXXX X X X"},
+  {"X X                          X X"},
+  {"X XXXXXXXXXXXXXXXXXXXXXXXXXXXX X"},
+  {"X                              X"},
+  {"XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX"}
+};
+
+#include "bench.h"
+
+#ifdef BENCH_AREA_SCRIPT
+const BenchQuery bench_script[BENCH_QUERIES] = {
+  {14,  9, 13,  9},   /* 1 step */
+  { 5, 21, 26, 21},   /* 27 steps */
+  {22,  7, 11, 12},   /* 46 steps */
+  { 7, 17, 15, 14},   /* 67 steps */
+  { 7,  9,  7,  1},   /* 96 steps */
+  {29, 28,  5, 11},   /* 139 steps */
+  {13, 16, 30, 26},   /* 219 steps */
+};
+#endif
@@ -0,0 +1,47 @@
+/* Generated by tools/mapgen.c: spiral 2, seed 1 -- do not edit */
+const char area[30][32] = {
+  {"XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX"},
+  {"X                              X"},
+  {"X                              X"},
+  {"X  X  XXXXXXXXXXXXXXXXXXXXXXX  X"},
+  {"X  X                        X  X"},
+  {"X  X                        X  X"},
+  {"X  X  XXXXXXXXXXXXXXXXXXXX  X  X"},
+  {"X  X  X                  X  X  X"},
+  {"X  X  X                  X  X  X"},
+  {"X  X  X  X  XXXXXXXXXXX  X  X  X"},
+  {"X  X  X  X            X  X  X  X"},
+  {"X  X  X  X            X  X  X  X"},
+  {"X  X  X  X  XXXXXXXX  X  X  X  X"},
+  {"X  X  X  X  X      X  X  X  X  X"},
+  {"X  X  X  X  X      X  X  X  X  X"},
+  {"X  X  X  X  X      X  X  X  X  X"},
+  {"X  X  X  X  X      X  X  X  X  X"},
+  {"X  X  X  X  XXXXX  X  X  X  X  X"},
+  {"X  X  X  X            X  X  X  X"},
+  {"X  X  X  X            X  X  X  X"},
+  {"X  X  X  XXXXXXXXXXXXXX  X  X  X"},
+  {"X  X  X                  X  X  X"},
+  {"X  X  X                  X  X  X"},
+  {"X  X  XXXXXXXXXXXXXXXXX  X  X  X"},
+  {"X  X                        X  X"},
+  {"X  X                        X  X"},
+  {"X  XXXXXXXXXXXXXXXXXXXXXXXXXX  X"},
+  {"X                              X"},
+  {"X                              X"},
+  {"XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX"}
+};
+
+#include "bench.h"
+
+#ifdef BENCH_AREA_SCRIPT
+const BenchQuery bench_script[BENCH_QUERIES] = {
+  {15, 24, 14, 24},   /* 1 step */
+  {22,  7, 15, 11},   /* 19 steps */
+  {26, 17,  8, 15},   /* 34 steps */
+  { 5,  4, 16, 21},   /* 48 steps */
+  { 9, 25, 16, 13},   /* 65 steps */
+  {10,  9,  1, 14},   /* 86 steps */
+  {26, 28, 16, 13},   /* 143 steps */
+};
+#endif
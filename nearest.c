@@ -0,0 +1,148 @@
+/*
+============================================================
+Nearest Target Search - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#include "nearest.h"
+#include "vis.h"
+#include <string.h>
+
+/*
+  nearest_from[cell]: direction of the step that first reached the
+  cell (right, left, down, up), walked backwards to trace the path.
+  Doubles as the visited set.
+*/
+#define FROM_START      0xFD
+#define FROM_TARGET     0xFE  /* Target not reached yet */
+#define FROM_NONE       0xFF  /* Open cell not reached yet */
+
+/* Static variables, hot ones in the zero page */
+#pragma bss-name (push, "ZEROPAGE")
+static SOLVER_LOCAL uint16_t  cell, next;
+static SOLVER_LOCAL uint16_t  head, tail;
+static SOLVER_LOCAL uint8_t   x, y, nx, ny;
+static SOLVER_LOCAL uint8_t   dir;
+#pragma bss-name (pop)
+
+static SOLVER_LOCAL int16_t   num_nodes, i;
+static SOLVER_LOCAL uint8_t   t;
+
+SOLVER_LOCAL uint8_t          nearest_target;
+SOLVER_LOCAL uint16_t         nearest_expanded;
+
+/* Writes the path to cell into the waypoints, start first */
+static int16_t trace_path(void) {
+  /* Length first, so that it can be written from the goal back */
+  num_nodes = 1;
+  for (next = cell; nearest_from[next] != FROM_START;
+       next -= grid_step[nearest_from[next]]) {
+    ++num_nodes;
+  }
+
+  i = num_nodes;
+  next = cell;
+  while (i--) {
+    waypointX[i] = GRID_X(next);
+    waypointY[i] = GRID_Y(next);
+    if (nearest_from[next] == FROM_START) break;
+    next -= grid_step[nearest_from[next]];
+  }
+  return num_nodes;
+}
+
+/* First target at (x, y) */
+static void find_target(const uint8_t* tx, const uint8_t* ty, uint8_t count) {
+  for (t = 0; t < count; ++t) {
+    if (tx[t] == x && ty[t] == y) break;
+  }
+  nearest_target = t;
+}
+
+int16_t __fastcall__ solve_nearest(uint8_t sx, uint8_t sy,
+                                   const uint8_t* tx, const uint8_t* ty,
+                                   uint8_t count) {
+  nearest_target = NEAREST_NONE;
+  nearest_expanded = 0;
+  if (sx >= GRID_SIZE_X || sy >= GRID_SIZE_Y || GRID_SOLID(sx, sy)) return 0;
+
+  /* Mark the targets, skipping the ones nothing can reach */
+  wram_owner = WRAM_OWNER_NEAREST;
+  memset(nearest_from, FROM_NONE, GRID_CELLS);
+  for (t = 0; t < count; ++t) {
+    x = tx[t];
+    y = ty[t];
+    if (x < GRID_SIZE_X && y < GRID_SIZE_Y && !GRID_SOLID(x, y)) {
+      nearest_from[GRID_INDEX(x, y)] = FROM_TARGET;
+    }
+  }
+
+  cell = GRID_INDEX(sx, sy);
+  x = sx;
+  y = sy;
+  if (nearest_from[cell] == FROM_TARGET) {
+    nearest_from[cell] = FROM_START;
+    find_target(tx, ty, count);
+    return trace_path();
+  }
+  nearest_from[cell] = FROM_START;
+
+  nearest_queue[0] = cell;
+  head = 0;
+  tail = 1;
+  while (head != tail) {
+    cell = nearest_queue[head++];
+    ++nearest_expanded;
+    VIS_EVENT(VIS_EXPANDED, cell);
+    x = GRID_X(cell);
+    y = GRID_Y(cell);
+
+    for (dir = 0; dir < 4; ++dir) {
+      nx = x + grid_dx[dir];
+      ny = y + grid_dy[dir];
+      if (nx >= GRID_SIZE_X || ny >= GRID_SIZE_Y || GRID_SOLID(nx, ny)) continue;
+
+      next = cell + grid_step[dir];
+      if (nearest_from[next] == FROM_NONE) {
+        nearest_from[next] = dir;
+        nearest_queue[tail++] = next;
+        VIS_EVENT(VIS_FRONTIER, next);
+      } else if (nearest_from[next] == FROM_TARGET) {
+        /* First reached is closest: no cell of this wave is nearer */
+        nearest_from[next] = dir;
+        cell = next;
+        x = nx;
+        y = ny;
+        find_target(tx, ty, count);
+        return trace_path();
+      }
+    }
+  }
+
+  /* No target reachable */
+  return 0;
+}
+
+void __fastcall__ initialize_nearest_solver(void) {
+  nearest_target = NEAREST_NONE;
+  nearest_expanded = 0;
+}
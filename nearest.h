@@ -0,0 +1,65 @@
+/*
+============================================================
+Nearest Target Search - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#ifndef NEAREST_H
+#define NEAREST_H
+
+#include "neslib.h"
+#include "grid.h"
+#include "wram.h"
+#include <inttypes.h>
+
+/*
+  Nearest of several targets in one search: a breadth-first wave
+  from the start stops at the first target it reaches, which is a
+  closest one (every step costs the same). Replaces one solve per
+  target when an actor wants the nearest pickup, exit or ally.
+
+  Swamps (see swamp.h) are not skipped: any target may be inside
+  one, and the wave stops long before it would pay off.
+*/
+
+/* nearest_target when no target was reached */
+#define NEAREST_NONE    0xFF
+
+/* Index into the target arrays of the last target reached */
+extern SOLVER_LOCAL uint8_t nearest_target;
+
+/* Cells taken off the queue by the last solve_nearest() call */
+extern SOLVER_LOCAL uint16_t nearest_expanded;
+
+void __fastcall__ initialize_nearest_solver(void);
+
+/*
+  Path from (sx, sy) to the nearest of the count cells (tx[i], ty[i]),
+  into waypointX/waypointY like the other solvers; returns its node
+  count, 0 if none can be reached. Targets off the grid or on solid
+  cells are ignored. A target on the start cell is a one-node path.
+*/
+int16_t __fastcall__ solve_nearest(uint8_t sx, uint8_t sy,
+                                   const uint8_t* tx, const uint8_t* ty,
+                                   uint8_t count);
+
+#endif // nearest.h
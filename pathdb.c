@@ -0,0 +1,126 @@
+/*
+============================================================
+Compressed Path Database - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#include "pathdb.h"
+#include "wram.h"
+
+#ifdef PATHDB_MMC3
+#define MMC3_BANK_SELECT  (*(volatile byte*)0x8000)
+#define MMC3_BANK_DATA    (*(volatile byte*)0x8001)
+#define MMC3_PRG_A000     7  /* R7: 8 KB bank at $A000 */
+#endif
+
+#define IN_BOUNDS_X(x_) ((x_) < GRID_SIZE_X)
+#define IN_BOUNDS_Y(y_) ((y_) < GRID_SIZE_Y)
+
+/* Static variables, hot ones in the zero page */
+#pragma bss-name (push, "ZEROPAGE")
+static SOLVER_LOCAL const word* row;
+static SOLVER_LOCAL uint16_t  key;
+static SOLVER_LOCAL uint16_t  lo, hi, mid;
+static SOLVER_LOCAL uint8_t   x, y;
+#pragma bss-name (pop)
+
+static SOLVER_LOCAL uint16_t  number;
+static SOLVER_LOCAL uint16_t  goal;
+static SOLVER_LOCAL int16_t   num_nodes;
+static SOLVER_LOCAL uint8_t   dir;
+static SOLVER_LOCAL uint8_t   b;
+
+#ifdef PATHDB_MMC3
+static SOLVER_LOCAL uint8_t   bank = 0xFF;
+#endif
+
+SOLVER_LOCAL uint16_t         pathdb_expanded;
+
+/* Points row at the row of cell number, swapping its bank in */
+static void seek_row(void) {
+  for (b = 0; pathdb_bank_end[b] <= number; ++b);
+#ifdef PATHDB_MMC3
+  if (b != bank) {
+    bank = b;
+    MMC3_BANK_SELECT = MMC3_PRG_A000;
+    MMC3_BANK_DATA = PATHDB_FIRST_BANK + bank;
+  }
+#endif
+  row = pathdb_row[number];
+}
+
+/* Move of the last run starting at or before the goal's number */
+static uint8_t first_move(void) {
+  lo = 1;
+  hi = row[0] + 1;
+  while (hi - lo > 1) {
+    mid = (lo + hi) >> 1;
+    if (row[mid] <= key) lo = mid;
+    else hi = mid;
+  }
+  return (uint8_t)row[lo] & 3;
+}
+
+int16_t __fastcall__ solve_pathdb(uint8_t sx, uint8_t sy, uint8_t dx, uint8_t dy) {
+  /* Reject invalid / degenerate requests */
+  pathdb_expanded = 0;
+  if (sx == dx && sy == dy) return 0;
+  if (!IN_BOUNDS_X(sx) || !IN_BOUNDS_X(dx) || !IN_BOUNDS_Y(sy) || !IN_BOUNDS_Y(dy)) return 0;
+  number = pathdb_order[GRID_INDEX(sx, sy)];
+  goal = pathdb_order[GRID_INDEX(dx, dy)];
+  if (number == PATHDB_SOLID || goal == PATHDB_SOLID) return 0;
+
+  /* Unreachable unless both numbers are in the same component */
+  for (b = 0; pathdb_component_end[b] <= number; ++b);
+  if (goal >= pathdb_component_end[b]) return 0;
+  if (b && goal < pathdb_component_end[b - 1]) return 0;
+
+  /* Runs are compared whole: any move at the goal's number */
+  key = (goal << 2) | 3;
+
+  x = sx;
+  y = sy;
+  waypointX[0] = x;
+  waypointY[0] = y;
+  num_nodes = 1;
+  while (x != dx || y != dy) {
+    /* Stale tables could walk in circles */
+    if (num_nodes == WAYPOINT_COUNT) return 0;
+    seek_row();
+    ++pathdb_expanded;
+    dir = first_move();
+    x += grid_dx[dir];
+    y += grid_dy[dir];
+    waypointX[num_nodes] = x;
+    waypointY[num_nodes] = y;
+    ++num_nodes;
+    number = pathdb_order[GRID_INDEX(x, y)];
+  }
+  return num_nodes;
+}
+
+void __fastcall__ initialize_pathdb_solver(void) {
+#ifdef PATHDB_MMC3
+  /* Force a bank switch on the first lookup */
+  bank = 0xFF;
+#endif
+}
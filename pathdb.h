@@ -0,0 +1,78 @@
+/*
+============================================================
+Compressed Path Database - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#ifndef PATHDB_H
+#define PATHDB_H
+
+#include "neslib.h"
+#include "grid.h"
+#include <inttypes.h>
+
+/*
+  Shortest paths on area with no search at all: tools/pathdb.c
+  stores, for every open cell, the first move toward every other
+  cell, run-length encoded into pathdb_data.c. solve_pathdb() just
+  follows those moves, one table lookup per step, and writes the
+  path to waypointX/waypointY like the other solvers.
+
+  Cells are numbered in depth-first order (pathdb_order), and row
+  p holds the runs of first moves from the cell numbered p:
+
+    row[0]      run count n
+    row[1..n]   (first cell number << 2) | move, ascending
+
+  Moves are right, left, down, up. The numbering also keeps every
+  connected component in one range of numbers, which tells when
+  two cells cannot reach each other.
+
+  With PATHDB_MMC3 defined (here, so that pathdb.c and
+  pathdb_data.c agree), the rows go to segments PATHDB0, PATHDB1...
+  which the linker config must map to 8 KB PRG banks at $A000;
+  pathdb.c swaps them in through MMC3 register R7, leaving $8000
+  to world.c. Without it, the rows stay in fixed ROM (about 18 KB
+  for area).
+
+  The tables describe area: regenerate them after editing it. They
+  say nothing about world windows (WORLD_MODE).
+*/
+//#define PATHDB_MMC3
+#define PATHDB_FIRST_BANK 4
+
+#define PATHDB_CELLS      GRID_CELLS
+#define PATHDB_SOLID      0xFFFF
+
+/* Packed database (pathdb_data.c) */
+extern const word        pathdb_order[PATHDB_CELLS];  /* cell -> number    */
+extern const word        pathdb_component_end[];      /* last number + 1   */
+extern const word* const pathdb_row[];                /* number -> row     */
+extern const word        pathdb_bank_end[];           /* last row + 1      */
+
+/* Rows looked up by the last solve_pathdb() call */
+extern SOLVER_LOCAL uint16_t pathdb_expanded;
+
+void __fastcall__ initialize_pathdb_solver(void);
+int16_t __fastcall__ solve_pathdb(uint8_t sx, uint8_t sy, uint8_t dx, uint8_t dy);
+
+#endif // pathdb.h
@@ -0,0 +1,3224 @@
+/* Generated by tools/pathdb.c from area.c -- do not edit */
+#include "pathdb.h"
+
+#ifdef PATHDB_MMC3
+#pragma rodata-name (push, "PATHDB0")
+#endif
+
+static const word row0[4] = {
+  3,0,554,2672,
+};
+
+static const word row1[5] = {
+  4,1,8,558,2672,
+};
+
+static const word row2[5] = {
+  4,1,12,562,2672,
+};
+
+static const word row3[5] = {
+  4,1,16,566,2672,
+};
+
+static const word row4[5] = {
+  4,1,20,354,2672,
+};
+
+static const word row5[25] = {
+  24,1,24,357,700,713,732,745,768,781,996,1105,
+  1300,1321,1560,1565,1656,1661,1992,2001,2092,2129,2144,2154,
+  2672,
+};
+
+static const word row6[27] = {
+  26,1,28,361,436,441,696,717,728,749,764,801,
+  992,1109,1296,1321,1556,1565,1656,1661,1992,2005,2088,2133,
+  2140,2154,2672,
+};
+
+static const word row7[21] = {
+  20,1,32,365,432,441,692,805,988,1113,1292,1321,
+  1552,1569,1656,1661,1992,2009,2080,2158,2672,
+};
+
+static const word row8[25] = {
+  24,1,36,369,428,441,688,809,984,1117,1288,1321,
+  1548,1573,1596,1609,1656,1661,1992,2013,2076,2161,2172,2182,
+  2672,
+};
+
+static const word row9[25] = {
+  24,1,40,373,424,441,684,813,980,1121,1284,1321,
+  1544,1577,1592,1613,1656,1661,1992,2017,2072,2165,2172,2186,
+  2672,
+};
+
+static const word row10[23] = {
+  22,1,44,377,420,441,680,817,976,1125,1280,1321,
+  1540,1617,1656,1661,1992,2021,2068,2169,2172,2186,2672,
+};
+
+static const word row11[21] = {
+  20,1,48,381,416,441,676,821,972,1129,1276,1321,
+  1536,1621,1656,1661,1992,2041,2064,2186,2672,
+};
+
+static const word row12[25] = {
+  24,1,52,385,412,441,664,825,968,1133,1272,1321,
+  1532,1621,1656,1661,1756,1777,1992,2045,2056,2189,2300,2318,
+  2672,
+};
+
+static const word row13[23] = {
+  22,1,56,389,408,441,652,829,964,1137,1268,1321,
+  1528,1621,1656,1661,1744,1781,1992,2193,2300,2318,2672,
+};
+
+static const word row14[27] = {
+  26,1,60,393,404,441,648,833,960,1141,1264,1321,
+  1412,1421,1524,1629,1656,1661,1740,1785,1848,1853,1992,2197,
+  2296,2318,2672,
+};
+
+static const word row15[27] = {
+  26,1,64,441,644,837,956,1145,1260,1321,1408,1425,
+  1520,1633,1656,1661,1736,1789,1844,1853,1992,2201,2272,2281,
+  2292,2318,2672,
+};
+
+static const word row16[27] = {
+  26,1,68,445,640,841,952,1149,1256,1321,1404,1429,
+  1516,1633,1656,1661,1732,1793,1840,1853,1992,2205,2268,2285,
+  2292,2317,2672,
+};
+
+static const word row17[26] = {
+  25,1,72,174,449,636,845,948,1153,1252,1321,1400,
+  1433,1512,1633,1656,1661,1728,1801,1836,1853,1992,2209,2264,
+  2317,2672,
+};
+
+static const word row18[28] = {
+  27,1,76,178,453,520,525,632,849,944,1157,1248,
+  1321,1396,1437,1508,1633,1656,1661,1724,1805,1832,1853,1992,
+  2213,2260,2317,2672,
+};
+
+static const word row19[28] = {
+  27,1,80,182,457,516,525,628,853,940,1161,1244,
+  1321,1392,1441,1504,1633,1656,1661,1720,1809,1828,1853,1992,
+  2217,2256,2317,2672,
+};
+
+static const word row20[30] = {
+  29,1,84,170,461,512,529,620,857,936,1165,1240,
+  1321,1388,1445,1500,1633,1656,1661,1712,1813,1824,1857,1992,
+  2221,2252,2317,2412,2417,2672,
+};
+
+static const word row21[28] = {
+  27,1,88,158,465,508,533,616,861,932,1169,1236,
+  1321,1384,1449,1492,1637,1656,1661,1708,1865,1992,2225,2248,
+  2317,2408,2417,2672,
+};
+
+static const word row22[28] = {
+  27,1,92,162,469,504,537,612,865,928,1173,1232,
+  1321,1380,1453,1488,1637,1656,1661,1704,1865,1992,2229,2248,
+  2317,2404,2421,2672,
+};
+
+static const word row23[28] = {
+  27,1,96,166,473,500,541,604,869,924,1177,1228,
+  1321,1376,1457,1484,1641,1656,1661,1696,1869,1992,2233,2248,
+  2317,2400,2425,2672,
+};
+
+static const word row24[28] = {
+  27,1,100,138,477,498,545,602,873,920,1181,1224,
+  1321,1372,1461,1480,1645,1656,1661,1694,1873,1994,2237,2250,
+  2317,2398,2429,2674,
+};
+
+static const word row25[27] = {
+  26,1,104,142,300,313,332,345,672,877,916,1185,
+  1220,1321,1368,1465,1476,1649,1656,1661,1992,2029,2104,2153,
+  2300,2317,2672,
+};
+
+static const word row26[27] = {
+  26,1,108,146,296,317,328,349,668,881,912,1189,
+  1216,1321,1364,1469,1472,1649,1656,1661,1992,2033,2100,2153,
+  2300,2317,2672,
+};
+
+static const word row27[23] = {
+  22,1,112,149,292,477,660,885,908,1193,1212,1321,
+  1360,1649,1656,1661,1748,1873,1992,2237,2300,2317,2672,
+};
+
+static const word row28[34] = {
+  33,1,116,126,153,284,481,492,549,596,889,900,
+  1197,1208,1321,1328,1341,1356,1653,1656,1661,1688,1881,1964,
+  1969,1992,2241,2248,2317,2392,2433,2464,2469,2672,
+};
+
+static const word row29[11] = {
+  10,1,122,209,282,2341,2390,2437,2462,2469,2674,
+};
+
+static const word row30[12] = {
+  11,3,125,130,213,266,2345,2386,2445,2458,2469,2674,
+};
+
+static const word row31[11] = {
+  10,3,120,211,280,2343,2388,2439,2460,2471,2672,
+};
+
+static const word row32[9] = {
+  8,3,134,247,254,2355,2382,2475,2674,
+};
+
+static const word row33[8] = {
+  7,3,137,251,253,302,2473,2674,
+};
+
+static const word row34[7] = {
+  6,1,104,141,294,2473,2674,
+};
+
+static const word row35[25] = {
+  24,1,108,145,296,317,328,349,672,885,908,1193,
+  1212,1321,1360,1649,1656,1661,1992,2029,2100,2153,2300,2317,
+  2672,
+};
+
+static const word row36[7] = {
+  6,1,112,149,286,2473,2672,
+};
+
+static const word row37[9] = {
+  8,1,116,153,282,2353,2380,2473,2672,
+};
+
+static const word row38[13] = {
+  12,3,120,157,235,257,278,2345,2384,2445,2456,2469,
+  2672,
+};
+
+static const word row39[13] = {
+  12,1,92,161,236,257,274,2341,2388,2437,2460,2469,
+  2672,
+};
+
+static const word row40[35] = {
+  34,1,96,165,240,257,270,481,492,549,596,877,
+  916,1185,1220,1321,1368,1465,1476,1649,1656,1661,1688,1881,
+  1964,1969,1992,2241,2248,2317,2392,2433,2464,2469,2672,
+};
+
+static const word row41[32] = {
+  31,3,120,169,231,252,259,266,477,496,545,600,
+  873,920,1181,1224,1321,1372,1461,1480,1645,1656,1661,1692,
+  1873,1992,2237,2248,2317,2396,2429,2672,
+};
+
+static const word row42[32] = {
+  31,3,120,173,219,252,263,264,473,500,541,604,
+  869,924,1177,1228,1321,1376,1457,1484,1641,1656,1661,1696,
+  1869,1992,2233,2248,2317,2400,2425,2672,
+};
+
+static const word row43[31] = {
+  30,1,76,177,194,209,220,469,504,537,612,865,
+  928,1173,1232,1321,1380,1453,1488,1637,1656,1661,1704,1865,
+  1992,2229,2248,2317,2404,2421,2672,
+};
+
+static const word row44[31] = {
+  30,1,80,181,190,209,224,465,508,533,616,861,
+  932,1169,1236,1321,1384,1449,1492,1637,1656,1661,1708,1865,
+  1992,2225,2248,2317,2408,2417,2672,
+};
+
+static const word row45[32] = {
+  31,3,120,186,211,252,463,512,531,620,859,936,
+  1167,1240,1323,1388,1447,1500,1635,1656,1663,1712,1815,1824,
+  1859,1992,2223,2252,2319,2412,2419,2672,
+};
+
+static const word row46[4] = {
+  3,3,188,211,
+};
+
+static const word row47[6] = {
+  5,3,185,192,206,211,
+};
+
+static const word row48[5] = {
+  4,3,185,198,211,
+};
+
+static const word row49[5] = {
+  4,3,200,205,223,
+};
+
+static const word row50[2] = {
+  1,1,
+};
+
+static const word row51[4] = {
+  3,3,196,211,
+};
+
+static const word row52[29] = {
+  28,3,130,215,266,459,518,527,630,855,942,1163,
+  1246,1323,1394,1443,1506,1635,1658,1663,1722,1811,1830,1855,
+  1994,2219,2258,2319,2674,
+};
+
+static const word row53[28] = {
+  27,3,134,216,455,520,527,632,851,944,1159,1248,
+  1323,1396,1439,1508,1635,1656,1663,1724,1807,1832,1855,1992,
+  2215,2260,2319,2672,
+};
+
+static const word row54[29] = {
+  28,3,132,177,220,457,516,525,628,853,940,1161,
+  1244,1321,1392,1441,1504,1633,1656,1661,1720,1809,1828,1853,
+  1992,2217,2256,2317,2672,
+};
+
+static const word row55[33] = {
+  32,3,132,181,192,209,224,461,512,529,620,857,
+  936,1165,1240,1321,1388,1445,1500,1633,1656,1661,1712,1813,
+  1824,1857,1992,2221,2252,2317,2412,2417,2672,
+};
+
+static const word row56[30] = {
+  29,3,134,209,228,262,465,508,533,616,861,932,
+  1169,1236,1321,1384,1449,1492,1637,1656,1661,1708,1865,1992,
+  2225,2248,2317,2408,2417,2672,
+};
+
+static const word row57[30] = {
+  29,3,134,209,232,258,469,504,537,612,865,928,
+  1173,1232,1321,1380,1453,1488,1637,1656,1661,1704,1865,1992,
+  2229,2248,2317,2404,2421,2672,
+};
+
+static const word row58[31] = {
+  30,3,132,161,236,257,276,473,500,541,604,869,
+  924,1177,1228,1321,1376,1457,1484,1641,1656,1661,1696,1869,
+  1992,2233,2248,2317,2400,2425,2672,
+};
+
+static const word row59[31] = {
+  30,3,132,165,240,257,272,477,496,545,600,873,
+  920,1181,1224,1321,1372,1461,1480,1645,1656,1661,1692,1873,
+  1992,2237,2248,2317,2396,2429,2672,
+};
+
+static const word row60[36] = {
+  35,3,134,209,244,254,257,270,481,494,549,598,
+  877,918,1185,1222,1321,1370,1465,1478,1649,1658,1661,1690,
+  1881,1966,1969,1994,2241,2250,2317,2394,2433,2466,2469,2674,
+};
+
+static const word row61[5] = {
+  4,3,137,248,253,
+};
+
+static const word row62[16] = {
+  15,3,141,303,313,335,345,675,1689,1995,2029,2107,
+  2153,2303,2393,2675,
+};
+
+static const word row63[11] = {
+  10,3,130,215,266,2343,2390,2439,2462,2471,2674,
+};
+
+static const word row64[30] = {
+  29,3,130,215,261,266,473,502,541,606,869,926,
+  1177,1230,1321,1378,1457,1486,1641,1658,1661,1698,1869,1994,
+  2233,2250,2317,2402,2425,2674,
+};
+
+static const word row65[29] = {
+  28,3,130,215,256,471,504,539,612,867,928,1175,
+  1232,1323,1380,1455,1488,1639,1656,1663,1704,1867,1992,2231,
+  2248,2319,2404,2423,2672,
+};
+
+static const word row66[30] = {
+  29,3,268,483,492,551,596,879,916,1187,1220,1323,
+  1368,1467,1476,1651,1656,1663,1688,1883,1964,1971,1992,2243,
+  2248,2319,2392,2435,2464,2471,
+};
+
+static const word row67[9] = {
+  8,3,265,272,2341,2388,2437,2460,2471,
+};
+
+static const word row68[9] = {
+  8,3,265,276,2345,2384,2445,2456,2471,
+};
+
+static const word row69[7] = {
+  6,3,265,280,2353,2380,2475,
+};
+
+static const word row70[5] = {
+  4,3,265,284,2475,
+};
+
+static const word row71[5] = {
+  4,3,265,290,2495,
+};
+
+static const word row72[6] = {
+  5,3,292,318,2515,2672,
+};
+
+static const word row73[8] = {
+  7,1,108,145,296,314,2513,2672,
+};
+
+static const word row74[6] = {
+  5,3,265,300,310,2515,
+};
+
+static const word row75[5] = {
+  4,3,265,306,2515,
+};
+
+static const word row76[5] = {
+  4,3,309,334,2519,
+};
+
+static const word row77[6] = {
+  5,3,304,313,330,2519,
+};
+
+static const word row78[6] = {
+  5,3,304,317,326,2519,
+};
+
+static const word row79[5] = {
+  4,3,304,322,2519,
+};
+
+static const word row80[10] = {
+  9,3,324,350,397,678,2317,2523,2653,2672,
+};
+
+static const word row81[9] = {
+  8,3,321,328,346,397,674,2317,2672,
+};
+
+static const word row82[9] = {
+  8,3,321,332,342,397,670,2317,2675,
+};
+
+static const word row83[8] = {
+  7,3,321,338,397,662,2317,2675,
+};
+
+static const word row84[7] = {
+  6,3,341,662,2293,2302,2319,
+};
+
+static const word row85[8] = {
+  7,3,336,345,670,2293,2300,2319,
+};
+
+static const word row86[8] = {
+  7,3,336,349,674,2293,2300,2319,
+};
+
+static const word row87[7] = {
+  6,3,336,353,678,2293,2523,
+};
+
+static const word row88[8] = {
+  7,3,336,357,439,574,2293,2527,
+};
+
+static const word row89[8] = {
+  7,3,336,361,435,574,2293,2531,
+};
+
+static const word row90[8] = {
+  7,3,336,365,431,574,2293,2535,
+};
+
+static const word row91[8] = {
+  7,3,336,369,427,574,2293,2539,
+};
+
+static const word row92[8] = {
+  7,3,336,373,423,574,2293,2543,
+};
+
+static const word row93[8] = {
+  7,3,336,377,419,574,2293,2547,
+};
+
+static const word row94[9] = {
+  8,3,336,381,415,574,2293,2302,2319,
+};
+
+static const word row95[26] = {
+  25,3,336,385,411,573,664,857,944,1157,1248,1321,
+  1396,1437,1508,1633,1656,1661,1756,1793,1992,2045,2056,2189,
+  2300,2319,
+};
+
+static const word row96[9] = {
+  8,3,336,389,407,574,2084,2186,2319,
+};
+
+static const word row97[9] = {
+  8,3,336,393,403,574,2084,2194,2319,
+};
+
+static const word row98[6] = {
+  5,3,336,399,620,2319,
+};
+
+static const word row99[27] = {
+  26,1,64,394,400,441,628,845,956,1145,1260,1321,
+  1408,1425,1520,1633,1656,1661,1720,1809,1828,1853,1992,2217,
+  2256,2317,2672,
+};
+
+static const word row100[10] = {
+  9,1,60,390,397,404,441,622,2317,2672,
+};
+
+static const word row101[12] = {
+  11,1,56,386,397,408,441,646,2317,2608,2617,2672,
+};
+
+static const word row102[14] = {
+  13,1,52,382,397,412,441,666,2317,2552,2565,2596,
+  2621,2672,
+};
+
+static const word row103[14] = {
+  13,1,48,378,397,416,441,654,2317,2548,2569,2592,
+  2625,2672,
+};
+
+static const word row104[14] = {
+  13,1,44,374,397,420,441,702,2317,2544,2573,2588,
+  2629,2672,
+};
+
+static const word row105[14] = {
+  13,1,40,370,397,424,441,698,2317,2540,2577,2584,
+  2633,2672,
+};
+
+static const word row106[12] = {
+  11,1,36,366,397,428,441,694,2317,2536,2637,2672,
+};
+
+static const word row107[12] = {
+  11,1,32,362,397,432,441,690,2317,2532,2641,2672,
+};
+
+static const word row108[12] = {
+  11,1,28,358,397,436,441,686,2317,2528,2645,2672,
+};
+
+static const word row109[10] = {
+  9,1,24,354,397,682,2317,2524,2649,2672,
+};
+
+static const word row110[25] = {
+  24,1,68,445,632,841,960,1141,1264,1321,1412,1421,
+  1524,1629,1656,1661,1724,1805,1832,1853,1992,2213,2260,2317,
+  2672,
+};
+
+static const word row111[24] = {
+  23,1,72,449,522,636,837,964,1137,1268,1321,1528,
+  1621,1656,1661,1736,1801,1836,1853,1992,2209,2264,2317,2672,
+};
+
+static const word row112[27] = {
+  26,1,76,453,518,640,833,968,1133,1272,1321,1532,
+  1621,1656,1661,1740,1785,1840,1853,1992,2205,2268,2285,2292,
+  2317,2415,2672,
+};
+
+static const word row113[29] = {
+  28,1,80,213,220,457,514,648,829,972,1129,1276,
+  1321,1536,1621,1656,1661,1744,1781,1848,1853,1992,2201,2272,
+  2281,2292,2317,2411,2672,
+};
+
+static const word row114[13] = {
+  12,1,84,209,224,461,510,2084,2198,2292,2317,2403,
+  2672,
+};
+
+static const word row115[15] = {
+  14,1,88,181,192,209,228,465,506,2084,2222,2292,
+  2317,2395,2672,
+};
+
+static const word row116[13] = {
+  12,1,92,177,232,469,502,2084,2226,2292,2317,2391,
+  2672,
+};
+
+static const word row117[15] = {
+  14,1,96,173,236,261,264,473,498,2084,2230,2292,
+  2317,2387,2672,
+};
+
+static const word row118[15] = {
+  14,1,112,169,240,257,264,477,494,2084,2234,2292,
+  2317,2383,2672,
+};
+
+static const word row119[15] = {
+  14,1,116,165,252,257,268,481,490,2084,2238,2292,
+  2317,2379,2672,
+};
+
+static const word row120[12] = {
+  11,3,120,163,272,486,2084,2242,2292,2318,2359,2672,
+};
+
+static const word row121[6] = {
+  5,3,488,550,2317,2363,
+};
+
+static const word row122[7] = {
+  6,3,485,492,546,2317,2379,
+};
+
+static const word row123[7] = {
+  6,3,485,496,542,2317,2383,
+};
+
+static const word row124[7] = {
+  6,3,485,500,538,2317,2387,
+};
+
+static const word row125[7] = {
+  6,3,485,504,534,2317,2391,
+};
+
+static const word row126[7] = {
+  6,3,485,508,530,2317,2395,
+};
+
+static const word row127[7] = {
+  6,3,485,512,526,2317,2403,
+};
+
+static const word row128[10] = {
+  9,3,485,516,525,2084,2197,2292,2317,2411,
+};
+
+static const word row129[26] = {
+  25,3,485,520,525,648,829,972,1129,1276,1321,1536,
+  1621,1656,1661,1744,1781,1848,1853,1992,2201,2272,2281,2292,
+  2317,2415,
+};
+
+static const word row130[24] = {
+  23,3,485,643,833,971,1133,1275,1321,1535,1621,1659,
+  1661,1743,1785,1843,1853,1995,2205,2271,2285,2295,2317,2675,
+};
+
+static const word row131[5] = {
+  4,3,529,614,2319,
+};
+
+static const word row132[6] = {
+  5,3,524,533,618,2319,
+};
+
+static const word row133[6] = {
+  5,3,524,537,606,2319,
+};
+
+static const word row134[6] = {
+  5,3,524,541,602,2319,
+};
+
+static const word row135[6] = {
+  5,3,524,545,598,2319,
+};
+
+static const word row136[6] = {
+  5,3,524,549,594,2319,
+};
+
+static const word row137[6] = {
+  5,3,524,553,590,2319,
+};
+
+static const word row138[6] = {
+  5,3,524,557,578,2319,
+};
+
+static const word row139[24] = {
+  23,3,524,561,580,793,1008,1029,1040,1061,1072,1093,
+  1312,1321,1656,1661,1676,1901,1916,1925,1936,1981,1992,2319,
+};
+
+static const word row140[24] = {
+  23,3,524,565,584,789,1012,1025,1044,1057,1076,1089,
+  1316,1321,1656,1661,1680,1893,1920,1925,1940,1977,1992,2319,
+};
+
+static const word row141[6] = {
+  5,3,524,570,1992,2319,
+};
+
+static const word row142[4] = {
+  3,3,574,2319,
+};
+
+static const word row143[10] = {
+  9,3,336,559,576,786,1752,1902,1992,2319,
+};
+
+static const word row144[27] = {
+  26,1,16,561,580,789,1012,1025,1044,1057,1076,1089,
+  1316,1321,1656,1662,1752,1890,1992,2317,2328,2337,2372,2481,
+  2508,2661,2672,
+};
+
+static const word row145[27] = {
+  26,1,12,565,584,793,1008,1029,1040,1061,1072,1093,
+  1312,1321,1656,1662,1752,1894,1992,2317,2324,2341,2368,2485,
+  2504,2665,2672,
+};
+
+static const word row146[16] = {
+  15,3,569,588,797,1004,1097,1308,1321,1656,1662,1752,
+  1898,1995,2300,2319,
+};
+
+static const word row147[16] = {
+  15,3,569,592,801,1000,1101,1304,1321,1656,1662,1752,
+  1866,1995,2300,2319,
+};
+
+static const word row148[18] = {
+  17,3,569,596,805,996,1105,1300,1321,1560,1565,1656,
+  1661,1704,1866,1995,2300,2319,
+};
+
+static const word row149[18] = {
+  17,3,569,600,809,992,1109,1296,1321,1556,1565,1656,
+  1661,1696,1870,1995,2300,2319,
+};
+
+static const word row150[18] = {
+  17,3,569,604,813,988,1113,1292,1321,1552,1569,1656,
+  1661,1692,1873,1995,2300,2319,
+};
+
+static const word row151[20] = {
+  19,3,569,610,817,986,1117,1290,1321,1550,1573,1598,
+  1609,1658,1661,1690,1881,1995,2302,2319,
+};
+
+static const word row152[8] = {
+  7,3,612,1887,1992,2223,2248,2319,
+};
+
+static const word row153[22] = {
+  21,1,88,181,192,209,228,465,508,533,616,822,
+  1925,1950,1953,1992,2225,2248,2317,2400,2421,2672,
+};
+
+static const word row154[9] = {
+  8,3,569,620,826,1925,1995,2300,2319,
+};
+
+static const word row155[8] = {
+  7,3,569,626,1925,1995,2302,2319,
+};
+
+static const word row156[9] = {
+  8,3,628,830,1853,1992,2211,2276,2319,
+};
+
+static const word row157[12] = {
+  11,1,76,445,632,834,1853,1992,2213,2260,2317,2672,
+};
+
+static const word row158[10] = {
+  9,3,569,636,838,1853,1992,2207,2300,2319,
+};
+
+static const word row159[10] = {
+  9,3,569,640,842,1853,1992,2203,2300,2319,
+};
+
+static const word row160[10] = {
+  9,3,569,644,846,1853,1992,2195,2300,2319,
+};
+
+static const word row161[12] = {
+  11,1,60,457,648,850,1853,1992,2197,2296,2317,2672,
+};
+
+static const word row162[11] = {
+  10,3,569,652,854,1853,1995,2277,2295,2300,2319,
+};
+
+static const word row163[9] = {
+  8,3,569,658,1853,1995,2277,2302,2319,
+};
+
+static const word row164[22] = {
+  21,3,660,857,944,1157,1248,1321,1396,1437,1508,1633,
+  1656,1661,1730,1797,1992,2039,2108,2155,2300,2319,
+};
+
+static const word row165[25] = {
+  24,1,108,385,664,861,940,1161,1244,1321,1392,1441,
+  1504,1633,1656,1661,1750,1797,1992,2041,2104,2185,2300,2317,
+  2672,
+};
+
+static const word row166[21] = {
+  20,3,569,668,865,936,1165,1240,1321,1388,1445,1500,
+  1633,1656,1661,1758,1797,1995,2277,2300,2319,
+};
+
+static const word row167[19] = {
+  18,3,569,672,869,932,1169,1236,1321,1384,1449,1492,
+  1637,1656,1661,1995,2277,2300,2319,
+};
+
+static const word row168[19] = {
+  18,3,569,676,873,928,1173,1232,1321,1380,1453,1488,
+  1637,1656,1661,1995,2277,2302,2319,
+};
+
+static const word row169[18] = {
+  17,3,569,680,877,924,1177,1228,1321,1376,1457,1484,
+  1641,1656,1661,1995,2277,2547,
+};
+
+static const word row170[18] = {
+  17,3,569,684,881,920,1181,1224,1321,1372,1461,1480,
+  1645,1656,1661,1995,2277,2543,
+};
+
+static const word row171[16] = {
+  15,3,569,688,885,916,1193,1220,1321,1368,1649,1656,
+  1661,1995,2277,2539,
+};
+
+static const word row172[19] = {
+  18,3,569,692,718,889,900,1197,1208,1321,1328,1341,
+  1356,1653,1656,1661,1995,2277,2535,
+};
+
+static const word row173[9] = {
+  8,3,569,696,714,1661,1995,2277,2531,
+};
+
+static const word row174[9] = {
+  8,3,569,700,710,1661,1995,2277,2527,
+};
+
+static const word row175[8] = {
+  7,3,569,706,1661,1995,2277,2523,
+};
+
+static const word row176[5] = {
+  4,3,709,734,1667,
+};
+
+static const word row177[6] = {
+  5,3,704,713,730,1667,
+};
+
+static const word row178[6] = {
+  5,3,704,717,726,1667,
+};
+
+static const word row179[5] = {
+  4,3,704,722,1663,
+};
+
+static const word row180[7] = {
+  6,3,724,750,757,760,1667,
+};
+
+static const word row181[8] = {
+  7,3,721,728,746,757,762,1671,
+};
+
+static const word row182[8] = {
+  7,3,721,732,742,757,766,1671,
+};
+
+static const word row183[7] = {
+  6,3,721,738,757,770,1671,
+};
+
+static const word row184[6] = {
+  5,3,741,770,1673,1995,
+};
+
+static const word row185[7] = {
+  6,3,736,745,766,1673,1995,
+};
+
+static const word row186[8] = {
+  7,3,736,749,762,1673,1906,1915,
+};
+
+static const word row187[6] = {
+  5,3,736,753,760,1671,
+};
+
+static const word row188[4] = {
+  3,0,759,760,
+};
+
+static const word row189[4] = {
+  3,0,754,1664,
+};
+
+static const word row190[11] = {
+  10,3,764,782,1679,1902,1919,1926,1935,1986,1995,
+};
+
+static const word row191[7] = {
+  6,3,761,768,778,1677,1995,
+};
+
+static const word row192[6] = {
+  5,3,761,774,1677,1995,
+};
+
+static const word row193[6] = {
+  5,3,777,910,1661,1995,
+};
+
+static const word row194[15] = {
+  14,3,772,781,912,1189,1216,1321,1364,1469,1472,1649,
+  1656,1661,1995,
+};
+
+static const word row195[21] = {
+  20,3,772,785,916,1185,1220,1321,1368,1465,1476,1649,
+  1656,1661,1683,1897,1923,1925,1939,1981,1995,
+};
+
+static const word row196[29] = {
+  28,1,8,565,580,789,920,1181,1224,1321,1372,1461,
+  1480,1645,1656,1661,1684,1893,1940,1977,1992,2317,2324,2341,
+  2364,2489,2500,2669,2672,
+};
+
+static const word row197[29] = {
+  28,1,12,561,584,793,924,1177,1228,1321,1376,1457,
+  1484,1641,1656,1661,1688,1889,1944,1973,1992,2317,2328,2337,
+  2368,2485,2504,2665,2672,
+};
+
+static const word row198[29] = {
+  28,1,16,557,588,797,928,1173,1232,1321,1380,1453,
+  1488,1637,1656,1661,1692,1885,1948,1953,1960,1969,1992,2317,
+  2372,2481,2508,2661,2672,
+};
+
+static const word row199[29] = {
+  28,1,28,553,592,801,932,1169,1236,1321,1384,1449,
+  1492,1637,1656,1661,1696,1881,1964,1969,1992,2245,2248,2317,
+  2376,2469,2528,2657,2672,
+};
+
+static const word row200[31] = {
+  30,1,32,481,492,549,596,805,936,1165,1240,1321,
+  1388,1445,1500,1633,1656,1661,1700,1869,1992,2241,2248,2317,
+  2380,2437,2456,2469,2532,2641,2672,
+};
+
+static const word row201[31] = {
+  30,1,36,477,496,545,600,809,940,1161,1244,1321,
+  1392,1441,1504,1633,1656,1661,1704,1865,1992,2237,2248,2317,
+  2384,2433,2460,2469,2536,2637,2672,
+};
+
+static const word row202[33] = {
+  32,1,40,473,500,541,604,813,944,1157,1248,1321,
+  1396,1437,1508,1633,1656,1661,1708,1865,1992,2233,2248,2317,
+  2388,2429,2464,2469,2540,2577,2584,2633,2672,
+};
+
+static const word row203[31] = {
+  30,1,44,469,504,537,608,817,948,1153,1252,1321,
+  1400,1433,1512,1633,1656,1661,1712,1865,1992,2229,2248,2317,
+  2392,2425,2544,2573,2588,2629,2672,
+};
+
+static const word row204[33] = {
+  32,1,48,465,508,533,616,821,952,1149,1256,1321,
+  1404,1429,1516,1633,1656,1661,1720,1813,1820,1865,1992,2225,
+  2248,2317,2400,2421,2548,2569,2592,2625,2672,
+};
+
+static const word row205[33] = {
+  32,1,52,461,516,529,620,825,956,1145,1260,1321,
+  1408,1425,1520,1633,1656,1661,1724,1809,1824,1857,1992,2221,
+  2252,2317,2408,2417,2552,2565,2596,2621,2672,
+};
+
+static const word row206[31] = {
+  30,1,56,457,520,525,628,829,960,1141,1264,1321,
+  1412,1421,1524,1629,1656,1661,1728,1805,1828,1853,1992,2217,
+  2256,2317,2412,2417,2608,2617,2672,
+};
+
+static const word row207[23] = {
+  22,1,60,453,632,833,964,1137,1268,1321,1528,1621,
+  1656,1661,1732,1801,1832,1853,1992,2213,2260,2317,2672,
+};
+
+static const word row208[23] = {
+  22,1,64,449,636,837,968,1133,1272,1321,1532,1621,
+  1656,1661,1736,1793,1836,1853,1992,2209,2264,2317,2672,
+};
+
+static const word row209[25] = {
+  24,1,68,445,640,841,972,1129,1276,1321,1536,1621,
+  1656,1661,1740,1789,1840,1853,1992,2205,2268,2285,2292,2317,
+  2672,
+};
+
+static const word row210[25] = {
+  24,1,72,441,644,845,976,1125,1280,1321,1540,1617,
+  1656,1661,1744,1785,1844,1853,1992,2201,2272,2281,2292,2317,
+  2672,
+};
+
+static const word row211[27] = {
+  26,1,76,397,404,441,648,849,980,1121,1284,1321,
+  1544,1577,1592,1613,1656,1661,1748,1781,1848,1853,1992,2197,
+  2296,2317,2672,
+};
+
+static const word row212[27] = {
+  26,1,80,213,220,389,408,441,652,853,984,1117,
+  1288,1321,1548,1573,1596,1609,1656,1661,1752,1777,1992,2193,
+  2300,2317,2672,
+};
+
+static const word row213[27] = {
+  26,1,84,209,224,385,412,441,660,857,988,1113,
+  1292,1321,1552,1569,1656,1661,1756,1773,1992,2045,2056,2189,
+  2300,2317,2672,
+};
+
+static const word row214[29] = {
+  28,1,88,181,192,209,228,381,424,441,664,861,
+  992,1109,1296,1321,1556,1565,1656,1661,1760,1769,1992,2041,
+  2076,2185,2300,2317,2672,
+};
+
+static const word row215[25] = {
+  24,1,92,177,232,369,428,441,668,865,996,1105,
+  1300,1321,1560,1565,1656,1661,1992,2037,2080,2161,2300,2317,
+  2672,
+};
+
+static const word row216[25] = {
+  24,1,96,173,236,261,264,365,432,441,672,869,
+  1000,1101,1304,1321,1656,1661,1992,2029,2084,2157,2300,2317,
+  2672,
+};
+
+static const word row217[23] = {
+  22,1,100,169,240,257,264,361,436,441,676,873,
+  1004,1097,1308,1321,1656,1661,1992,2025,2088,2153,2672,
+};
+
+static const word row218[25] = {
+  24,1,104,165,248,257,268,357,680,877,1008,1029,
+  1040,1061,1072,1093,1312,1321,1656,1661,1992,2021,2092,2153,
+  2672,
+};
+
+static const word row219[23] = {
+  22,1,108,161,292,353,684,881,1012,1025,1044,1057,
+  1076,1089,1316,1321,1656,1661,1992,2017,2096,2153,2672,
+};
+
+static const word row220[18] = {
+  17,1,112,145,296,317,328,349,688,885,902,1656,
+  1661,1992,2013,2100,2153,2672,
+};
+
+static const word row221[20] = {
+  19,1,116,141,300,313,332,345,692,889,898,1656,
+  1661,1992,2009,2104,2129,2140,2153,2672,
+};
+
+static const word row222[6] = {
+  5,3,704,894,1656,1663,
+};
+
+static const word row223[5] = {
+  4,3,896,1194,1663,
+};
+
+static const word row224[6] = {
+  5,3,893,900,1198,1663,
+};
+
+static const word row225[5] = {
+  4,3,893,906,1663,
+};
+
+static const word row226[8] = {
+  7,3,908,1186,1564,1649,1656,1663,
+};
+
+static const word row227[25] = {
+  24,1,108,161,292,353,700,713,732,745,768,781,
+  912,1190,1564,1649,1656,1661,1992,2001,2096,2121,2148,2153,
+  2672,
+};
+
+static const word row228[22] = {
+  21,1,104,165,248,257,268,357,696,785,916,1182,
+  1564,1646,1649,1656,1661,1992,2013,2092,2153,2672,
+};
+
+static const word row229[24] = {
+  23,1,100,169,240,257,264,361,436,441,684,789,
+  920,1178,1564,1642,1649,1656,1661,1992,2017,2088,2153,2672,
+};
+
+static const word row230[24] = {
+  23,1,96,173,236,261,264,365,432,441,680,793,
+  924,1170,1564,1638,1649,1656,1661,1992,2021,2084,2157,2672,
+};
+
+static const word row231[21] = {
+  20,1,92,177,232,369,428,441,676,797,928,1174,
+  1564,1637,1656,1661,1992,2025,2080,2161,2672,
+};
+
+static const word row232[28] = {
+  27,1,88,181,192,209,228,373,424,441,672,801,
+  932,1166,1564,1634,1649,1656,1661,1992,2029,2076,2165,2172,
+  2181,2300,2317,2672,
+};
+
+static const word row233[25] = {
+  24,1,84,209,224,377,420,441,668,805,936,1146,
+  1564,1633,1656,1661,1992,2037,2072,2169,2172,2185,2300,2317,
+  2672,
+};
+
+static const word row234[25] = {
+  24,1,80,213,220,381,416,441,664,809,940,1150,
+  1564,1633,1656,1661,1760,1769,1992,2041,2068,2185,2300,2317,
+  2672,
+};
+
+static const word row235[23] = {
+  22,1,76,385,412,441,660,813,944,1154,1564,1633,
+  1656,1661,1756,1773,1992,2045,2056,2189,2300,2317,2672,
+};
+
+static const word row236[21] = {
+  20,1,72,389,408,441,652,817,948,1158,1564,1633,
+  1656,1661,1752,1777,1992,2193,2300,2317,2672,
+};
+
+static const word row237[23] = {
+  22,1,68,397,404,441,648,821,952,1162,1564,1633,
+  1656,1661,1748,1781,1848,1853,1992,2197,2296,2317,2672,
+};
+
+static const word row238[24] = {
+  23,1,64,441,644,825,956,1142,1564,1630,1649,1656,
+  1661,1744,1785,1844,1853,1992,2201,2272,2281,2292,2317,2672,
+};
+
+static const word row239[24] = {
+  23,1,60,445,640,829,960,1126,1564,1622,1649,1656,
+  1661,1740,1789,1840,1853,1992,2205,2268,2285,2292,2317,2672,
+};
+
+static const word row240[25] = {
+  24,1,56,449,636,833,964,1129,1276,1322,1536,1621,
+  1656,1661,1736,1793,1836,1853,1992,2209,2264,2317,2608,2617,
+  2672,
+};
+
+static const word row241[27] = {
+  26,1,52,453,632,837,968,1133,1272,1321,1532,1621,
+  1656,1661,1732,1801,1832,1853,1992,2213,2260,2317,2552,2565,
+  2596,2621,2672,
+};
+
+static const word row242[31] = {
+  30,1,48,457,520,525,628,841,972,1137,1268,1321,
+  1530,1621,1656,1661,1728,1805,1828,1853,1992,2217,2256,2317,
+  2412,2417,2548,2569,2592,2625,2672,
+};
+
+static const word row243[30] = {
+  29,1,44,461,516,529,620,845,976,1122,1321,1526,
+  1625,1656,1661,1724,1809,1824,1857,1992,2221,2252,2317,2408,
+  2417,2544,2573,2588,2629,2672,
+};
+
+static const word row244[30] = {
+  29,1,40,465,508,533,616,849,980,1118,1321,1542,
+  1625,1656,1661,1720,1813,1820,1865,1992,2225,2248,2317,2400,
+  2421,2540,2577,2584,2633,2672,
+};
+
+static const word row245[26] = {
+  25,1,36,469,504,537,608,853,984,1114,1321,1546,
+  1625,1656,1661,1712,1865,1992,2229,2248,2317,2392,2425,2536,
+  2637,2672,
+};
+
+#ifdef PATHDB_MMC3
+#pragma rodata-name (pop)
+#pragma rodata-name (push, "PATHDB1")
+#endif
+
+static const word row246[28] = {
+  27,1,32,473,500,541,604,857,988,1098,1321,1550,
+  1625,1656,1661,1708,1865,1992,2233,2248,2317,2388,2429,2464,
+  2469,2532,2641,2672,
+};
+
+static const word row247[27] = {
+  26,1,28,477,496,545,600,861,992,1101,1304,1321,
+  1656,1661,1704,1865,1992,2237,2248,2317,2384,2433,2460,2469,
+  2528,2645,2672,
+};
+
+static const word row248[29] = {
+  28,1,24,481,492,549,596,865,996,1105,1300,1321,
+  1560,1565,1656,1661,1700,1869,1992,2241,2248,2317,2380,2437,
+  2456,2469,2524,2649,2672,
+};
+
+static const word row249[27] = {
+  26,1,20,553,592,869,1000,1109,1296,1321,1556,1565,
+  1656,1661,1696,1881,1964,1969,1992,2245,2248,2317,2376,2469,
+  2520,2657,2672,
+};
+
+static const word row250[26] = {
+  25,1,16,557,588,873,1004,1030,1321,1554,1565,1656,
+  1661,1692,1885,1948,1953,1960,1969,1992,2317,2372,2481,2508,
+  2661,2672,
+};
+
+static const word row251[24] = {
+  23,1,12,561,584,877,1008,1026,1321,1656,1661,1688,
+  1889,1944,1973,1992,2317,2328,2337,2368,2485,2504,2665,2672,
+};
+
+static const word row252[24] = {
+  23,1,8,565,580,881,1012,1022,1321,1656,1661,1684,
+  1893,1940,1977,1992,2317,2324,2341,2364,2489,2500,2669,2672,
+};
+
+static const word row253[6] = {
+  5,3,893,1018,1321,1659,
+};
+
+static const word row254[6] = {
+  5,3,1021,1046,1333,1659,
+};
+
+static const word row255[7] = {
+  6,3,1016,1025,1042,1333,1659,
+};
+
+static const word row256[7] = {
+  6,3,1016,1029,1038,1333,1659,
+};
+
+static const word row257[9] = {
+  8,3,1016,1034,1335,1498,1587,1622,1651,
+};
+
+static const word row258[9] = {
+  8,3,1036,1062,1347,1474,1603,1622,1651,
+};
+
+static const word row259[7] = {
+  6,3,1033,1040,1058,1345,1659,
+};
+
+static const word row260[7] = {
+  6,3,1033,1044,1054,1345,1659,
+};
+
+static const word row261[6] = {
+  5,3,1033,1050,1345,1659,
+};
+
+static const word row262[6] = {
+  5,3,1053,1078,1413,1659,
+};
+
+static const word row263[7] = {
+  6,3,1048,1057,1074,1413,1659,
+};
+
+static const word row264[7] = {
+  6,3,1048,1061,1070,1413,1659,
+};
+
+static const word row265[7] = {
+  6,3,1048,1066,1415,1418,1651,
+};
+
+static const word row266[6] = {
+  5,3,1068,1094,1349,1659,
+};
+
+static const word row267[7] = {
+  6,3,1065,1072,1090,1349,1659,
+};
+
+static const word row268[7] = {
+  6,3,1065,1076,1086,1349,1659,
+};
+
+static const word row269[6] = {
+  5,3,1065,1082,1349,1659,
+};
+
+static const word row270[6] = {
+  5,3,1085,1318,1321,1659,
+};
+
+static const word row271[7] = {
+  6,3,1080,1089,1314,1321,1659,
+};
+
+static const word row272[7] = {
+  6,3,1080,1093,1310,1321,1659,
+};
+
+static const word row273[7] = {
+  6,3,1080,1097,1306,1321,1659,
+};
+
+static const word row274[9] = {
+  8,3,1080,1101,1302,1321,1563,1637,1659,
+};
+
+static const word row275[9] = {
+  8,3,1080,1105,1298,1321,1559,1637,1659,
+};
+
+static const word row276[9] = {
+  8,3,1080,1109,1294,1321,1555,1637,1659,
+};
+
+static const word row277[9] = {
+  8,3,1080,1113,1290,1321,1551,1637,1659,
+};
+
+static const word row278[9] = {
+  8,3,1080,1117,1286,1321,1547,1637,1659,
+};
+
+static const word row279[9] = {
+  8,3,1080,1121,1282,1321,1543,1637,1659,
+};
+
+static const word row280[9] = {
+  8,3,1080,1125,1278,1321,1539,1637,1659,
+};
+
+static const word row281[9] = {
+  8,3,1080,1129,1274,1321,1535,1637,1659,
+};
+
+static const word row282[9] = {
+  8,3,1080,1133,1270,1321,1531,1637,1659,
+};
+
+static const word row283[9] = {
+  8,3,1080,1137,1266,1321,1527,1637,1659,
+};
+
+static const word row284[9] = {
+  8,3,1080,1141,1262,1321,1411,1637,1659,
+};
+
+static const word row285[9] = {
+  8,3,1080,1145,1258,1321,1391,1637,1659,
+};
+
+static const word row286[9] = {
+  8,3,1080,1149,1254,1321,1395,1637,1659,
+};
+
+static const word row287[9] = {
+  8,3,1080,1153,1250,1321,1399,1637,1659,
+};
+
+static const word row288[9] = {
+  8,3,1080,1157,1246,1321,1403,1637,1659,
+};
+
+static const word row289[9] = {
+  8,3,1080,1161,1242,1321,1407,1637,1659,
+};
+
+static const word row290[9] = {
+  8,3,1080,1165,1238,1321,1387,1637,1659,
+};
+
+static const word row291[9] = {
+  8,3,1080,1169,1234,1321,1379,1637,1659,
+};
+
+static const word row292[25] = {
+  24,1,92,177,232,369,428,441,676,797,928,1173,
+  1230,1321,1380,1453,1488,1637,1656,1661,1992,2025,2080,2161,
+  2672,
+};
+
+static const word row293[9] = {
+  8,3,1016,1177,1226,1321,1375,1496,1639,
+};
+
+static const word row294[9] = {
+  8,3,1016,1181,1222,1321,1371,1496,1643,
+};
+
+static const word row295[9] = {
+  8,3,1016,1185,1218,1321,1363,1496,1647,
+};
+
+static const word row296[29] = {
+  28,1,108,161,292,353,700,713,732,745,768,781,
+  912,1189,1214,1321,1364,1469,1472,1649,1656,1661,1992,2001,
+  2096,2121,2148,2153,2672,
+};
+
+static const word row297[8] = {
+  7,3,1016,1193,1210,1323,1472,1651,
+};
+
+static const word row298[8] = {
+  7,3,1016,1197,1206,1323,1472,1655,
+};
+
+static const word row299[7] = {
+  6,3,1016,1202,1323,1472,1651,
+};
+
+static const word row300[4] = {
+  3,3,1204,1323,
+};
+
+static const word row301[5] = {
+  4,3,1201,1208,1323,
+};
+
+static const word row302[5] = {
+  4,3,1201,1212,1323,
+};
+
+static const word row303[5] = {
+  4,3,1201,1216,1323,
+};
+
+static const word row304[5] = {
+  4,3,1201,1220,1323,
+};
+
+static const word row305[5] = {
+  4,3,1201,1224,1323,
+};
+
+static const word row306[5] = {
+  4,3,1201,1228,1323,
+};
+
+static const word row307[5] = {
+  4,3,1201,1232,1323,
+};
+
+static const word row308[5] = {
+  4,3,1201,1236,1323,
+};
+
+static const word row309[5] = {
+  4,3,1201,1240,1323,
+};
+
+static const word row310[5] = {
+  4,3,1201,1244,1323,
+};
+
+static const word row311[5] = {
+  4,3,1201,1248,1323,
+};
+
+static const word row312[5] = {
+  4,3,1201,1252,1323,
+};
+
+static const word row313[5] = {
+  4,3,1201,1256,1323,
+};
+
+static const word row314[5] = {
+  4,3,1201,1260,1323,
+};
+
+static const word row315[5] = {
+  4,3,1201,1264,1323,
+};
+
+static const word row316[5] = {
+  4,3,1201,1268,1323,
+};
+
+static const word row317[5] = {
+  4,3,1201,1272,1323,
+};
+
+static const word row318[5] = {
+  4,3,1201,1276,1323,
+};
+
+static const word row319[5] = {
+  4,3,1201,1280,1323,
+};
+
+static const word row320[5] = {
+  4,3,1201,1284,1323,
+};
+
+static const word row321[5] = {
+  4,3,1201,1288,1323,
+};
+
+static const word row322[5] = {
+  4,3,1201,1292,1323,
+};
+
+static const word row323[5] = {
+  4,3,1201,1296,1323,
+};
+
+static const word row324[5] = {
+  4,3,1201,1300,1323,
+};
+
+static const word row325[5] = {
+  4,3,1201,1304,1323,
+};
+
+static const word row326[5] = {
+  4,3,1201,1308,1323,
+};
+
+static const word row327[5] = {
+  4,3,1201,1312,1323,
+};
+
+static const word row328[5] = {
+  4,3,1201,1316,1323,
+};
+
+static const word row329[4] = {
+  3,3,1201,1659,
+};
+
+static const word row330[7] = {
+  6,3,1034,1324,1343,1496,1651,
+};
+
+static const word row331[8] = {
+  7,3,1034,1321,1328,1339,1496,1655,
+};
+
+static const word row332[9] = {
+  8,3,1034,1321,1335,1498,1619,1634,1651,
+};
+
+static const word row333[5] = {
+  4,3,1082,1337,1355,
+};
+
+static const word row334[25] = {
+  24,1,116,141,300,313,332,345,692,889,900,1194,
+  1332,1341,1356,1653,1656,1661,1992,2009,2104,2129,2140,2153,
+  2672,
+};
+
+static const word row335[7] = {
+  6,3,1050,1332,1347,1416,1651,
+};
+
+static const word row336[4] = {
+  3,3,1082,1351,
+};
+
+static const word row337[6] = {
+  5,3,1064,1194,1352,1655,
+};
+
+static const word row338[10] = {
+  9,3,1064,1197,1208,1321,1328,1341,1356,1651,
+};
+
+static const word row339[8] = {
+  7,3,1066,1345,1360,1470,1584,1651,
+};
+
+static const word row340[8] = {
+  7,3,1066,1345,1364,1466,1584,1651,
+};
+
+static const word row341[9] = {
+  8,3,1066,1345,1368,1462,1584,1646,1651,
+};
+
+static const word row342[9] = {
+  8,3,1066,1345,1372,1458,1584,1642,1651,
+};
+
+static const word row343[9] = {
+  8,3,1066,1345,1376,1454,1584,1638,1651,
+};
+
+static const word row344[9] = {
+  8,3,1066,1345,1380,1450,1584,1637,1659,
+};
+
+static const word row345[9] = {
+  8,3,1066,1345,1384,1446,1584,1634,1651,
+};
+
+static const word row346[9] = {
+  8,3,1066,1345,1388,1442,1584,1633,1659,
+};
+
+static const word row347[9] = {
+  8,3,1066,1345,1392,1438,1584,1633,1659,
+};
+
+static const word row348[9] = {
+  8,3,1066,1345,1396,1434,1584,1633,1659,
+};
+
+static const word row349[9] = {
+  8,3,1066,1345,1400,1430,1584,1633,1659,
+};
+
+static const word row350[9] = {
+  8,3,1066,1345,1404,1426,1584,1633,1659,
+};
+
+static const word row351[9] = {
+  8,3,1066,1345,1408,1422,1584,1630,1651,
+};
+
+static const word row352[9] = {
+  8,3,1066,1345,1412,1418,1584,1622,1651,
+};
+
+static const word row353[6] = {
+  5,3,1125,1567,1621,1659,
+};
+
+static const word row354[11] = {
+  10,3,1050,1321,1411,1421,1522,1603,1622,1637,1659,
+};
+
+static const word row355[12] = {
+  11,3,1050,1321,1407,1416,1425,1502,1600,1630,1637,1659,
+};
+
+static const word row356[12] = {
+  11,3,1048,1161,1244,1321,1403,1416,1429,1504,1633,1659,
+};
+
+static const word row357[12] = {
+  11,3,1048,1157,1248,1321,1399,1416,1433,1508,1633,1659,
+};
+
+static const word row358[12] = {
+  11,3,1048,1153,1252,1321,1395,1416,1437,1512,1633,1659,
+};
+
+static const word row359[12] = {
+  11,3,1048,1149,1256,1321,1391,1416,1441,1516,1633,1659,
+};
+
+static const word row360[11] = {
+  10,3,1050,1321,1387,1416,1445,1494,1600,1633,1659,
+};
+
+static const word row361[11] = {
+  10,3,1050,1321,1383,1416,1449,1490,1600,1634,1651,
+};
+
+static const word row362[11] = {
+  10,3,1050,1321,1379,1416,1453,1486,1600,1637,1659,
+};
+
+static const word row363[11] = {
+  10,3,1050,1321,1375,1416,1457,1482,1600,1638,1651,
+};
+
+static const word row364[11] = {
+  10,3,1050,1321,1371,1416,1461,1478,1600,1642,1651,
+};
+
+static const word row365[11] = {
+  10,3,1050,1321,1367,1416,1465,1474,1600,1646,1651,
+};
+
+static const word row366[11] = {
+  10,3,1048,1189,1216,1321,1363,1416,1469,1472,1651,
+};
+
+static const word row367[7] = {
+  6,3,1048,1186,1351,1416,1651,
+};
+
+static const word row368[8] = {
+  7,3,1032,1182,1335,1476,1646,1651,
+};
+
+static const word row369[9] = {
+  8,3,1032,1178,1335,1473,1480,1642,1651,
+};
+
+static const word row370[9] = {
+  8,3,1032,1170,1335,1473,1484,1638,1651,
+};
+
+static const word row371[10] = {
+  9,3,1032,1173,1232,1323,1473,1488,1637,1659,
+};
+
+static const word row372[9] = {
+  8,3,1034,1335,1473,1492,1634,1637,1659,
+};
+
+static const word row373[9] = {
+  8,3,1034,1335,1473,1498,1619,1633,1659,
+};
+
+static const word row374[8] = {
+  7,3,1016,1162,1351,1500,1633,1659,
+};
+
+static const word row375[28] = {
+  27,1,80,213,220,381,416,441,664,809,952,1158,
+  1349,1404,1429,1504,1633,1656,1661,1760,1769,1992,2041,2068,
+  2185,2300,2317,2672,
+};
+
+static const word row376[26] = {
+  25,1,76,385,412,441,660,813,948,1154,1349,1400,
+  1433,1508,1633,1656,1661,1756,1773,1992,2045,2056,2189,2300,
+  2317,2672,
+};
+
+static const word row377[24] = {
+  23,1,72,389,408,441,652,817,944,1150,1349,1396,
+  1437,1512,1633,1656,1661,1752,1777,1992,2193,2300,2317,2672,
+};
+
+static const word row378[26] = {
+  25,1,68,397,404,441,648,821,940,1146,1349,1392,
+  1441,1516,1633,1656,1661,1748,1781,1848,1853,1992,2197,2296,
+  2317,2672,
+};
+
+static const word row379[10] = {
+  9,3,1016,1142,1351,1473,1520,1631,1633,1659,
+};
+
+static const word row380[10] = {
+  9,3,1016,1138,1351,1473,1524,1627,1633,1659,
+};
+
+static const word row381[25] = {
+  24,1,56,449,636,833,972,1134,1349,1528,1623,1633,
+  1656,1661,1736,1793,1836,1853,1992,2209,2264,2317,2608,2617,
+  2672,
+};
+
+static const word row382[26] = {
+  25,1,52,453,632,837,968,1130,1349,1532,1621,1656,
+  1661,1732,1801,1832,1853,1992,2213,2260,2317,2552,2565,2596,
+  2621,2672,
+};
+
+static const word row383[31] = {
+  30,1,48,457,520,525,628,841,964,1126,1349,1536,
+  1583,1621,1656,1661,1728,1805,1828,1853,1992,2217,2256,2317,
+  2412,2417,2548,2569,2592,2625,2672,
+};
+
+static const word row384[9] = {
+  8,3,1016,1122,1349,1540,1579,1621,1659,
+};
+
+static const word row385[9] = {
+  8,3,1016,1118,1349,1544,1575,1621,1659,
+};
+
+static const word row386[9] = {
+  8,3,1016,1114,1349,1548,1571,1621,1659,
+};
+
+static const word row387[9] = {
+  8,3,1016,1110,1349,1552,1567,1621,1659,
+};
+
+static const word row388[28] = {
+  27,1,28,477,496,545,600,861,1000,1106,1349,1556,
+  1565,1656,1661,1704,1865,1992,2237,2248,2317,2384,2433,2460,
+  2469,2528,2645,2672,
+};
+
+static const word row389[28] = {
+  27,1,24,481,492,549,596,865,996,1102,1349,1560,
+  1565,1656,1661,1700,1869,1992,2241,2248,2317,2380,2437,2456,
+  2469,2524,2649,2672,
+};
+
+static const word row390[24] = {
+  23,1,20,553,592,869,992,1098,1349,1656,1661,1696,
+  1881,1964,1969,1992,2245,2248,2317,2376,2469,2520,2657,2672,
+};
+
+static const word row391[9] = {
+  8,3,1034,1413,1550,1569,1599,1621,1659,
+};
+
+static const word row392[10] = {
+  9,3,1034,1413,1546,1564,1573,1595,1621,1659,
+};
+
+static const word row393[10] = {
+  9,3,1034,1413,1542,1564,1577,1591,1621,1659,
+};
+
+static const word row394[10] = {
+  9,3,1034,1415,1418,1564,1581,1587,1621,1651,
+};
+
+static const word row395[6] = {
+  5,0,1126,1564,1622,1656,
+};
+
+static const word row396[9] = {
+  8,3,1050,1347,1474,1588,1615,1622,1651,
+};
+
+static const word row397[10] = {
+  9,3,1050,1345,1542,1585,1592,1611,1621,1659,
+};
+
+static const word row398[10] = {
+  9,3,1050,1345,1546,1585,1596,1607,1621,1659,
+};
+
+static const word row399[9] = {
+  8,3,1050,1345,1550,1585,1603,1621,1659,
+};
+
+static const word row400[7] = {
+  6,3,1066,1333,1550,1605,1659,
+};
+
+static const word row401[8] = {
+  7,3,1066,1333,1546,1600,1609,1659,
+};
+
+static const word row402[8] = {
+  7,3,1066,1333,1542,1600,1613,1659,
+};
+
+static const word row403[9] = {
+  8,3,1066,1333,1498,1600,1617,1622,1651,
+};
+
+static const word row404[6] = {
+  5,3,1064,1323,1524,1627,
+};
+
+static const word row405[6] = {
+  5,1,1018,1333,1526,1625,
+};
+
+static const word row406[9] = {
+  8,3,1034,1335,1498,1619,1620,1629,1659,
+};
+
+static const word row407[8] = {
+  7,3,1034,1335,1498,1616,1634,1651,
+};
+
+static const word row408[7] = {
+  6,3,1016,1166,1351,1496,1639,
+};
+
+static const word row409[6] = {
+  5,3,1082,1351,1641,1659,
+};
+
+static const word row410[7] = {
+  6,3,1082,1351,1636,1645,1659,
+};
+
+static const word row411[6] = {
+  5,3,1082,1351,1636,1651,
+};
+
+static const word row412[8] = {
+  7,3,904,1198,1564,1653,1656,1663,
+};
+
+static const word row413[6] = {
+  5,3,904,1194,1564,1663,
+};
+
+static const word row414[4] = {
+  3,3,906,1663,
+};
+
+static const word row415[4] = {
+  3,3,726,1667,
+};
+
+static const word row416[10] = {
+  9,3,612,738,756,762,1668,1903,1992,2319,
+};
+
+static const word row417[10] = {
+  9,3,612,761,1672,1899,1992,2247,2248,2319,
+};
+
+static const word row418[8] = {
+  7,3,612,773,1676,1895,1992,2319,
+};
+
+static const word row419[8] = {
+  7,3,612,785,1680,1891,1992,2319,
+};
+
+static const word row420[20] = {
+  19,3,612,789,1012,1025,1044,1057,1076,1089,1316,1321,
+  1656,1661,1684,1883,1992,2223,2248,2319,
+};
+
+static const word row421[33] = {
+  32,1,116,165,252,257,268,469,508,537,608,793,
+  1008,1029,1040,1061,1072,1093,1312,1321,1656,1661,1688,1885,
+  1948,1953,1992,2229,2248,2317,2400,2425,2672,
+};
+
+static const word row422[13] = {
+  12,3,797,1004,1097,1308,1321,1656,1661,1692,1871,1905,
+  1947,
+};
+
+static const word row423[13] = {
+  12,3,801,1000,1101,1304,1321,1656,1661,1696,1867,1905,
+  1995,
+};
+
+static const word row424[14] = {
+  13,3,805,999,1105,1303,1321,1563,1565,1659,1661,1703,
+  1905,1995,
+};
+
+static const word row425[29] = {
+  28,1,92,177,232,481,492,549,596,809,992,1109,
+  1296,1321,1556,1565,1656,1662,1704,1865,1992,2241,2248,2317,
+  2380,2437,2456,2469,2672,
+};
+
+static const word row426[17] = {
+  16,3,813,988,1113,1292,1321,1552,1569,1656,1661,1708,
+  1815,1865,1967,1969,1995,
+};
+
+static const word row427[17] = {
+  16,3,817,984,1117,1288,1321,1548,1573,1596,1609,1656,
+  1661,1712,1811,1865,1995,
+};
+
+static const word row428[17] = {
+  16,3,821,983,1121,1287,1321,1547,1577,1595,1613,1659,
+  1661,1718,1799,1865,1995,
+};
+
+static const word row429[4] = {
+  3,3,1720,1803,
+};
+
+static const word row430[23] = {
+  22,1,76,445,632,825,976,1125,1280,1321,1540,1617,
+  1656,1661,1724,1805,1832,1853,1992,2213,2260,2317,2672,
+};
+
+static const word row431[15] = {
+  14,3,829,972,1129,1276,1321,1536,1621,1656,1661,1728,
+  1795,1865,1995,
+};
+
+static const word row432[15] = {
+  14,3,833,968,1133,1272,1321,1532,1621,1656,1661,1732,
+  1791,1865,1995,
+};
+
+static const word row433[15] = {
+  14,3,837,964,1137,1268,1321,1528,1621,1656,1661,1736,
+  1787,1865,1995,
+};
+
+static const word row434[17] = {
+  16,3,841,960,1141,1264,1321,1412,1421,1524,1629,1656,
+  1661,1740,1783,1865,1995,
+};
+
+static const word row435[17] = {
+  16,3,845,956,1145,1260,1321,1408,1425,1520,1633,1656,
+  1661,1744,1779,1865,1995,
+};
+
+static const word row436[17] = {
+  16,3,849,952,1149,1256,1321,1404,1429,1516,1633,1656,
+  1661,1748,1771,1865,1995,
+};
+
+static const word row437[16] = {
+  15,3,853,951,1153,1255,1321,1403,1433,1515,1633,1659,
+  1661,1755,1865,1995,
+};
+
+static const word row438[17] = {
+  16,3,857,944,1157,1248,1321,1396,1437,1508,1633,1656,
+  1662,1756,1767,1773,1995,
+};
+
+static const word row439[16] = {
+  15,3,861,943,1161,1247,1321,1395,1441,1507,1633,1659,
+  1661,1763,1773,1995,
+};
+
+static const word row440[5] = {
+  4,3,1718,1765,1995,
+};
+
+static const word row441[6] = {
+  5,3,1718,1760,1769,1995,
+};
+
+static const word row442[6] = {
+  5,3,1718,1760,1774,1819,
+};
+
+static const word row443[19] = {
+  18,3,853,948,1153,1252,1321,1400,1433,1512,1633,1656,
+  1662,1752,1771,1777,1839,1865,1995,
+};
+
+static const word row444[33] = {
+  32,1,56,457,520,525,640,849,952,1149,1256,1321,
+  1404,1429,1516,1633,1656,1662,1752,1781,1840,1853,1992,2205,
+  2268,2285,2292,2317,2412,2417,2608,2617,2672,
+};
+
+static const word row445[27] = {
+  26,1,60,453,644,845,956,1145,1260,1321,1408,1425,
+  1520,1633,1656,1662,1752,1785,1844,1853,1992,2201,2272,2281,
+  2292,2317,2672,
+};
+
+static const word row446[25] = {
+  24,1,64,449,648,841,960,1141,1264,1321,1412,1421,
+  1524,1629,1656,1662,1752,1789,1848,1853,1992,2197,2296,2317,
+  2672,
+};
+
+static const word row447[23] = {
+  22,1,68,389,412,441,652,837,964,1137,1268,1321,
+  1528,1621,1656,1662,1752,1793,1992,2193,2300,2317,2672,
+};
+
+static const word row448[5] = {
+  4,3,1718,1752,1799,
+};
+
+static const word row449[16] = {
+  15,3,833,971,1133,1275,1321,1535,1621,1659,1661,1722,
+  1801,1835,1865,1995,
+};
+
+static const word row450[16] = {
+  15,3,829,972,1129,1276,1321,1536,1621,1656,1661,1724,
+  1805,1831,1865,1995,
+};
+
+static const word row451[16] = {
+  15,3,825,976,1125,1280,1321,1540,1617,1656,1662,1752,
+  1809,1827,1865,1995,
+};
+
+static const word row452[18] = {
+  17,3,821,980,1121,1284,1321,1544,1577,1592,1613,1656,
+  1662,1752,1813,1823,1865,1995,
+};
+
+static const word row453[19] = {
+  18,3,818,984,1118,1288,1322,1548,1574,1596,1610,1656,
+  1662,1752,1819,1866,1963,1986,1995,
+};
+
+static const word row454[25] = {
+  24,3,656,822,980,1122,1284,1322,1544,1578,1592,1614,
+  1656,1662,1760,1814,1820,1859,1861,1866,1959,1992,2227,2300,
+  2319,
+};
+
+static const word row455[22] = {
+  21,3,656,825,976,1125,1280,1321,1540,1617,1656,1662,
+  1760,1810,1817,1824,1855,1861,1992,2219,2300,2319,
+};
+
+static const word row456[21] = {
+  20,3,656,829,972,1129,1276,1321,1536,1621,1656,1662,
+  1760,1806,1817,1828,1853,1992,2211,2300,2319,
+};
+
+static const word row457[21] = {
+  20,3,656,833,968,1133,1272,1321,1532,1621,1656,1662,
+  1760,1802,1817,1832,1853,1992,2215,2300,2319,
+};
+
+static const word row458[21] = {
+  20,3,656,837,964,1137,1268,1321,1528,1621,1656,1662,
+  1760,1778,1817,1836,1853,1992,2207,2300,2319,
+};
+
+static const word row459[22] = {
+  21,3,656,841,960,1141,1264,1321,1412,1421,1524,1629,
+  1656,1661,1744,1781,1840,1853,1992,2203,2300,2319,
+};
+
+static const word row460[22] = {
+  21,3,656,845,956,1145,1260,1321,1408,1425,1520,1633,
+  1656,1661,1740,1785,1844,1853,1992,2195,2300,2319,
+};
+
+static const word row461[22] = {
+  21,3,656,849,952,1149,1256,1321,1404,1429,1516,1633,
+  1656,1661,1736,1789,1848,1853,1992,2199,2300,2319,
+};
+
+static const word row462[22] = {
+  21,3,656,853,948,1153,1252,1321,1400,1433,1512,1633,
+  1656,1661,1732,1793,1992,2047,2108,2191,2300,2319,
+};
+
+static const word row463[9] = {
+  8,3,624,826,1857,1992,2219,2276,2319,
+};
+
+static const word row464[11] = {
+  10,3,624,822,1852,1862,1955,1992,2227,2276,2319,
+};
+
+static const word row465[2] = {
+  1,0,
+};
+
+static const word row466[32] = {
+  31,1,96,173,236,261,264,477,496,545,600,805,
+  996,1105,1300,1321,1560,1565,1656,1662,1700,1869,1879,1992,
+  2237,2248,2317,2384,2433,2460,2469,2672,
+};
+
+static const word row467[29] = {
+  28,3,112,171,240,259,264,475,500,543,604,802,
+  1000,1102,1304,1322,1656,1662,1700,1875,1992,2235,2248,2319,
+  2388,2431,2464,2471,2672,
+};
+
+static const word row468[21] = {
+  20,1,116,165,252,257,268,469,508,537,610,1876,
+  1881,1951,1992,2229,2248,2317,2400,2425,2672,
+};
+
+static const word row469[21] = {
+  20,1,114,169,242,257,266,473,502,541,606,1873,
+  1994,2233,2250,2317,2390,2429,2466,2469,2674,
+};
+
+static const word row470[17] = {
+  16,1,612,797,1004,1097,1308,1321,1656,1661,1688,1885,
+  1947,1992,2221,2248,2317,
+};
+
+static const word row471[26] = {
+  25,3,624,793,1008,1029,1040,1061,1072,1093,1312,1321,
+  1656,1662,1700,1889,1922,1927,1992,2063,2112,2155,2276,2291,
+  2300,2319,
+};
+
+static const word row472[20] = {
+  19,3,624,789,1012,1025,1044,1057,1076,1089,1316,1321,
+  1656,1662,1700,1893,1918,1927,1992,2319,
+};
+
+static const word row473[10] = {
+  9,3,624,786,1700,1897,1914,1927,1992,2319,
+};
+
+static const word row474[12] = {
+  11,3,624,774,1700,1901,1910,1927,1992,2247,2276,2319,
+};
+
+static const word row475[9] = {
+  8,3,624,762,1700,1906,1927,1992,2319,
+};
+
+static const word row476[6] = {
+  5,3,738,1875,1908,1927,
+};
+
+static const word row477[7] = {
+  6,3,762,1875,1905,1912,1927,
+};
+
+static const word row478[7] = {
+  6,3,774,1875,1905,1916,1927,
+};
+
+static const word row479[7] = {
+  6,3,786,1875,1905,1920,1927,
+};
+
+static const word row480[6] = {
+  5,3,790,1875,1905,1943,
+};
+
+static const word row481[7] = {
+  6,3,658,1928,1983,1992,2319,
+};
+
+static const word row482[10] = {
+  9,3,658,1925,1932,1971,1992,2247,2300,2319,
+};
+
+static const word row483[16] = {
+  15,1,12,561,588,786,1925,1936,1973,1992,2317,2368,
+  2485,2504,2665,2672,
+};
+
+static const word row484[18] = {
+  17,1,8,565,584,790,1925,1940,1977,1992,2317,2324,
+  2341,2364,2489,2500,2669,2672,
+};
+
+static const word row485[13] = {
+  12,3,658,1925,1944,1955,1985,1992,2051,2116,2155,2300,
+  2319,
+};
+
+static const word row486[14] = {
+  13,1,626,1925,1948,1953,1992,2061,2112,2153,2276,2289,
+  2300,2317,
+};
+
+static const word row487[8] = {
+  7,1,614,1925,1994,2221,2250,2317,
+};
+
+static const word row488[6] = {
+  5,3,794,1855,1866,1959,
+};
+
+static const word row489[14] = {
+  13,3,797,1004,1097,1308,1321,1656,1662,1760,1866,1960,
+  1969,1995,
+};
+
+static const word row490[14] = {
+  13,3,801,1000,1101,1304,1321,1656,1661,1752,1865,1964,
+  1969,1995,
+};
+
+static const word row491[14] = {
+  13,3,805,999,1105,1303,1321,1563,1565,1659,1661,1707,
+  1865,1995,
+};
+
+static const word row492[20] = {
+  19,3,793,1008,1029,1040,1061,1072,1093,1312,1321,1656,
+  1661,1676,1897,1916,1925,1936,1973,1995,
+};
+
+static const word row493[20] = {
+  19,3,789,1012,1025,1044,1057,1076,1089,1316,1321,1656,
+  1661,1680,1893,1920,1925,1940,1977,1995,
+};
+
+static const word row494[9] = {
+  8,3,786,1760,1890,1952,1981,1990,1995,
+};
+
+static const word row495[8] = {
+  7,3,774,1760,1902,1952,1986,1995,
+};
+
+static const word row496[8] = {
+  7,3,762,1852,1902,1959,1988,2319,
+};
+
+static const word row497[8] = {
+  7,3,774,1855,1866,1959,1985,1995,
+};
+
+static const word row498[8] = {
+  7,3,485,702,1997,2071,2185,2523,
+};
+
+static const word row499[16] = {
+  15,1,24,377,420,441,698,1992,2001,2075,2169,2172,
+  2185,2524,2649,2672,
+};
+
+static const word row500[16] = {
+  15,1,28,373,424,441,694,1992,2005,2079,2165,2172,
+  2181,2528,2645,2672,
+};
+
+static const word row501[14] = {
+  13,1,32,369,428,441,690,1992,2009,2083,2161,2532,
+  2641,2672,
+};
+
+static const word row502[14] = {
+  13,1,36,365,432,441,686,1992,2013,2087,2157,2536,
+  2637,2672,
+};
+
+static const word row503[16] = {
+  15,1,40,361,436,441,682,1992,2017,2088,2153,2540,
+  2577,2584,2633,2672,
+};
+
+static const word row504[14] = {
+  13,1,44,357,678,1992,2021,2092,2153,2544,2573,2588,
+  2629,2672,
+};
+
+static const word row505[12] = {
+  11,1,100,353,674,1992,2025,2096,2153,2302,2317,2672,
+};
+
+static const word row506[16] = {
+  15,1,104,145,296,317,328,349,670,1992,2029,2100,
+  2153,2300,2317,2672,
+};
+
+static const word row507[16] = {
+  15,3,108,143,300,315,332,347,658,1992,2035,2104,
+  2155,2300,2319,2672,
+};
+
+static const word row508[10] = {
+  9,1,662,1853,1994,2037,2110,2153,2302,2317,
+};
+
+static const word row509[24] = {
+  23,3,625,664,861,940,1161,1244,1321,1392,1441,1504,
+  1633,1656,1661,1756,1769,1992,2041,2059,2112,2155,2300,2319,
+};
+
+static const word row510[10] = {
+  9,3,626,1992,2045,2055,2112,2187,2300,2319,
+};
+
+static const word row511[9] = {
+  8,3,626,1992,2051,2112,2191,2300,2319,
+};
+
+static const word row512[12] = {
+  11,3,609,646,1925,1994,2052,2191,2249,2299,2300,2319,
+};
+
+static const word row513[12] = {
+  11,3,609,654,1925,1994,2049,2056,2187,2249,2300,2319,
+};
+
+static const word row514[13] = {
+  12,3,609,666,1925,1994,2049,2063,2118,2155,2249,2302,
+  2319,
+};
+
+static const word row515[14] = {
+  13,3,485,666,1885,1994,2064,2122,2155,2172,2185,2302,
+  2317,2551,
+};
+
+static const word row516[9] = {
+  8,3,485,2068,2125,2151,2172,2185,2547,
+};
+
+static const word row517[27] = {
+  26,3,485,700,713,732,745,768,781,936,1165,1240,
+  1321,1388,1445,1500,1633,1656,1661,1992,2001,2072,2129,2147,
+  2174,2185,2543,
+};
+
+static const word row518[27] = {
+  26,3,485,696,717,728,749,764,861,932,1169,1236,
+  1321,1384,1449,1492,1637,1656,1661,1992,2005,2076,2133,2143,
+  2174,2185,2539,
+};
+
+static const word row519[22] = {
+  21,3,485,692,865,928,1173,1232,1321,1380,1453,1488,
+  1637,1656,1661,1992,2009,2080,2155,2174,2185,2535,
+};
+
+static const word row520[20] = {
+  19,3,485,691,869,927,1177,1231,1321,1379,1457,1487,
+  1641,1659,1661,1995,2013,2087,2173,2531,
+};
+
+static const word row521[20] = {
+  19,3,525,684,873,920,1181,1224,1321,1372,1461,1480,
+  1645,1656,1661,1992,2018,2088,2153,2531,
+};
+
+static const word row522[20] = {
+  19,3,525,680,877,916,1185,1220,1321,1368,1465,1476,
+  1649,1656,1661,1992,2021,2092,2153,2527,
+};
+
+static const word row523[20] = {
+  19,3,525,676,881,912,1189,1216,1321,1364,1469,1472,
+  1649,1656,1661,1992,2025,2096,2153,2523,
+};
+
+static const word row524[19] = {
+  18,3,525,672,885,908,1193,1212,1321,1360,1649,1656,
+  1661,1992,2029,2100,2153,2300,2319,
+};
+
+static const word row525[21] = {
+  20,3,525,668,889,900,1197,1208,1321,1328,1341,1356,
+  1653,1656,1661,1992,2033,2104,2153,2300,2319,
+};
+
+static const word row526[11] = {
+  10,3,525,662,1853,1994,2037,2110,2153,2302,2319,
+};
+
+static const word row527[12] = {
+  11,3,658,1927,1950,1955,1994,2051,2114,2155,2302,2319,
+};
+
+static const word row528[11] = {
+  10,3,626,1955,1994,2063,2117,2150,2155,2301,2319,
+};
+
+static const word row529[9] = {
+  8,0,610,2064,2121,2146,2152,2249,2356,
+};
+
+static const word row530[9] = {
+  8,0,486,2068,2125,2142,2152,2185,2520,
+};
+
+static const word row531[16] = {
+  15,1,24,377,420,442,2072,2129,2138,2152,2169,2172,
+  2185,2524,2649,2672,
+};
+
+static const word row532[15] = {
+  14,2,28,374,424,442,2076,2134,2152,2166,2172,2182,
+  2528,2646,2672,
+};
+
+static const word row533[12] = {
+  11,2,32,370,428,442,2083,2136,2162,2532,2642,2672,
+};
+
+static const word row534[15] = {
+  14,1,28,373,424,442,2079,2133,2140,2165,2172,2181,
+  2528,2645,2672,
+};
+
+static const word row535[15] = {
+  14,1,24,377,420,442,2075,2133,2144,2169,2172,2185,
+  2524,2649,2672,
+};
+
+static const word row536[8] = {
+  7,0,486,2071,2133,2148,2185,2520,
+};
+
+static const word row537[8] = {
+  7,3,610,2067,2133,2155,2249,2359,
+};
+
+static const word row538[21] = {
+  20,3,525,688,869,924,1177,1228,1321,1376,1457,1484,
+  1641,1656,1661,1992,2014,2084,2157,2174,2359,
+};
+
+static const word row539[21] = {
+  20,3,525,692,865,928,1173,1232,1321,1380,1453,1488,
+  1637,1656,1661,1992,2010,2084,2161,2174,2359,
+};
+
+static const word row540[27] = {
+  26,3,525,696,717,728,749,764,861,932,1169,1236,
+  1321,1384,1449,1492,1637,1656,1661,1992,2006,2084,2133,2140,
+  2165,2174,2359,
+};
+
+static const word row541[27] = {
+  26,3,525,700,713,732,745,768,781,936,1165,1240,
+  1321,1388,1445,1500,1633,1656,1661,1992,2002,2084,2129,2144,
+  2169,2174,2359,
+};
+
+static const word row542[8] = {
+  7,3,526,2084,2126,2148,2186,2359,
+};
+
+static const word row543[4] = {
+  3,3,2177,2535,
+};
+
+static const word row544[5] = {
+  4,3,2172,2181,2539,
+};
+
+static const word row545[4] = {
+  3,3,2172,2187,
+};
+
+static const word row546[18] = {
+  17,1,52,385,412,441,654,1885,1994,2060,2189,2300,
+  2317,2552,2565,2596,2621,2672,
+};
+
+static const word row547[12] = {
+  11,3,485,646,1885,1994,2060,2193,2299,2300,2317,2611,
+};
+
+static const word row548[15] = {
+  14,3,485,519,525,650,1885,1992,2197,2274,2289,2295,
+  2300,2317,2411,
+};
+
+static const word row549[17] = {
+  16,1,64,457,520,525,642,1885,1992,2201,2270,2289,
+  2292,2317,2412,2417,2672,
+};
+
+static const word row550[13] = {
+  12,1,68,453,638,1885,1992,2205,2266,2291,2292,2317,
+  2672,
+};
+
+static const word row551[12] = {
+  11,1,72,449,630,1885,1992,2209,2262,2288,2317,2672,
+};
+
+static const word row552[12] = {
+  11,1,76,445,634,1885,1992,2213,2258,2288,2317,2672,
+};
+
+static const word row553[14] = {
+  13,1,80,213,220,441,622,1885,1992,2217,2254,2288,
+  2317,2672,
+};
+
+static const word row554[12] = {
+  11,3,336,399,573,614,1885,1992,2221,2250,2288,2319,
+};
+
+static const word row555[23] = {
+  22,3,336,463,573,616,821,980,1121,1284,1321,1544,
+  1577,1592,1613,1656,1661,1708,1881,1992,2225,2248,2319,
+};
+
+static const word row556[9] = {
+  8,3,336,467,574,1992,2229,2248,2319,
+};
+
+static const word row557[9] = {
+  8,3,336,471,574,1992,2233,2248,2319,
+};
+
+static const word row558[9] = {
+  8,3,336,475,574,1992,2237,2248,2319,
+};
+
+static const word row559[9] = {
+  8,3,336,479,574,1992,2241,2248,2319,
+};
+
+static const word row560[9] = {
+  8,3,336,483,574,1992,2245,2248,2319,
+};
+
+static const word row561[7] = {
+  6,3,336,555,574,1992,2319,
+};
+
+static const word row562[7] = {
+  6,3,610,1992,2219,2252,2319,
+};
+
+static const word row563[8] = {
+  7,3,610,1992,2215,2249,2256,2319,
+};
+
+static const word row564[22] = {
+  21,3,609,632,833,968,1133,1272,1321,1532,1621,1656,
+  1661,1724,1805,1832,1853,1992,2211,2249,2260,2319,
+};
+
+static const word row565[12] = {
+  11,3,609,630,1925,1992,2207,2249,2264,2286,2288,2319,
+};
+
+static const word row566[13] = {
+  12,3,609,638,1925,1992,2203,2249,2268,2282,2291,2300,
+  2319,
+};
+
+static const word row567[13] = {
+  12,3,609,642,1925,1992,2199,2249,2272,2278,2291,2300,
+  2319,
+};
+
+static const word row568[25] = {
+  24,3,609,648,849,952,1149,1256,1321,1404,1429,1516,
+  1633,1656,1661,1736,1789,1848,1853,1992,2195,2249,2295,2300,
+  2319,
+};
+
+static const word row569[8] = {
+  7,3,626,2051,2281,2295,2302,2319,
+};
+
+static const word row570[9] = {
+  8,3,626,2051,2276,2285,2291,2300,2319,
+};
+
+static const word row571[6] = {
+  5,3,626,2051,2276,2319,
+};
+
+static const word row572[2] = {
+  1,2,
+};
+
+static const word row573[5] = {
+  4,3,526,2296,2319,
+};
+
+static const word row574[6] = {
+  5,3,526,2293,2302,2359,
+};
+
+static const word row575[4] = {
+  3,3,2306,2319,
+};
+
+static const word row576[4] = {
+  3,3,2310,2319,
+};
+
+static const word row577[4] = {
+  3,3,2312,2319,
+};
+
+static const word row578[2] = {
+  1,1,
+};
+
+static const word row579[9] = {
+  8,3,120,566,2320,2343,2396,2471,2672,
+};
+
+static const word row580[12] = {
+  11,1,16,562,2317,2324,2339,2372,2481,2508,2661,2672,
+};
+
+static const word row581[12] = {
+  11,1,12,558,2317,2328,2335,2368,2485,2504,2665,2672,
+};
+
+static const word row582[10] = {
+  9,1,8,554,2317,2364,2489,2500,2669,2672,
+};
+
+static const word row583[9] = {
+  8,1,18,2337,2374,2481,2510,2661,2674,
+};
+
+static const word row584[9] = {
+  8,1,122,2332,2341,2351,2396,2469,2672,
+};
+
+static const word row585[10] = {
+  9,3,128,159,278,2332,2347,2404,2447,2672,
+};
+
+static const word row586[8] = {
+  7,3,132,155,282,2348,2355,2672,
+};
+
+#ifdef PATHDB_MMC3
+#pragma rodata-name (pop)
+#pragma rodata-name (push, "PATHDB2")
+#endif
+
+static const word row587[9] = {
+  8,1,130,157,278,2345,2406,2445,2674,
+};
+
+static const word row588[4] = {
+  3,3,486,2359,
+};
+
+static const word row589[11] = {
+  10,3,284,554,2084,2246,2292,2318,2360,2491,2672,
+};
+
+static const word row590[27] = {
+  26,3,284,557,588,789,1012,1025,1044,1057,1076,1089,
+  1316,1321,1656,1661,1680,1893,1920,1925,1940,1973,1992,2317,
+  2364,2487,2672,
+};
+
+static const word row591[30] = {
+  29,3,284,561,584,793,1008,1029,1040,1061,1072,1093,
+  1312,1321,1656,1661,1676,1897,1916,1925,1936,1977,1992,2317,
+  2328,2333,2368,2470,2475,2672,
+};
+
+static const word row592[26] = {
+  25,3,284,565,580,797,1004,1097,1308,1321,1656,1661,
+  1672,1901,1912,1925,1932,1981,1992,2317,2324,2337,2372,2442,
+  2475,2672,
+};
+
+static const word row593[8] = {
+  7,3,286,2341,2376,2438,2475,2672,
+};
+
+static const word row594[10] = {
+  9,1,132,153,282,2341,2380,2434,2473,2672,
+};
+
+static const word row595[10] = {
+  9,1,128,157,278,2341,2384,2430,2473,2672,
+};
+
+static const word row596[10] = {
+  9,1,120,161,274,2341,2388,2426,2473,2672,
+};
+
+static const word row597[12] = {
+  11,1,116,165,252,257,270,2341,2392,2422,2473,2672,
+};
+
+static const word row598[11] = {
+  10,1,114,169,242,257,266,2341,2398,2473,2674,
+};
+
+static const word row599[12] = {
+  11,1,96,173,236,261,266,2347,2400,2418,2445,2672,
+};
+
+static const word row600[9] = {
+  8,1,94,177,234,2345,2406,2445,2674,
+};
+
+static const word row601[11] = {
+  10,1,88,181,192,209,230,2355,2408,2417,2672,
+};
+
+static const word row602[9] = {
+  8,1,84,209,226,2353,2412,2417,2672,
+};
+
+static const word row603[7] = {
+  6,1,82,213,222,2353,2674,
+};
+
+static const word row604[9] = {
+  8,1,92,177,234,2355,2404,2421,2672,
+};
+
+static const word row605[12] = {
+  11,1,96,173,236,261,266,2355,2404,2425,2467,2672,
+};
+
+static const word row606[12] = {
+  11,1,112,169,240,257,266,2355,2404,2429,2463,2672,
+};
+
+static const word row607[12] = {
+  11,1,116,165,252,257,270,2355,2404,2433,2459,2672,
+};
+
+static const word row608[10] = {
+  9,1,120,161,274,2355,2404,2437,2455,2672,
+};
+
+static const word row609[10] = {
+  9,3,128,159,278,2355,2404,2441,2451,2672,
+};
+
+static const word row610[7] = {
+  6,3,128,2347,2404,2447,2672,
+};
+
+static const word row611[10] = {
+  9,3,132,2343,2396,2442,2448,2469,2475,2672,
+};
+
+static const word row612[13] = {
+  12,3,132,155,282,2347,2396,2438,2445,2452,2469,2475,
+  2672,
+};
+
+static const word row613[12] = {
+  11,1,128,157,278,2347,2396,2434,2445,2456,2469,2672,
+};
+
+static const word row614[12] = {
+  11,1,120,161,274,2347,2396,2430,2445,2460,2469,2672,
+};
+
+static const word row615[14] = {
+  13,1,116,165,252,257,270,2347,2396,2426,2445,2464,
+  2469,2672,
+};
+
+static const word row616[12] = {
+  11,1,112,169,240,257,266,2347,2396,2422,2445,2672,
+};
+
+static const word row617[25] = {
+  24,3,132,567,580,799,1004,1099,1308,1323,1656,1663,
+  1672,1903,1912,1927,1932,1983,1992,2319,2324,2339,2396,2483,
+  2672,
+};
+
+static const word row618[5] = {
+  4,3,290,2477,2511,
+};
+
+static const word row619[6] = {
+  5,3,290,2472,2481,2507,
+};
+
+static const word row620[6] = {
+  5,3,290,2472,2485,2503,
+};
+
+static const word row621[6] = {
+  5,3,290,2472,2489,2499,
+};
+
+static const word row622[5] = {
+  4,3,290,2472,2495,
+};
+
+static const word row623[5] = {
+  4,3,306,2496,2671,
+};
+
+static const word row624[6] = {
+  5,3,306,2493,2500,2667,
+};
+
+static const word row625[6] = {
+  5,3,306,2493,2504,2663,
+};
+
+static const word row626[6] = {
+  5,3,306,2493,2508,2659,
+};
+
+static const word row627[6] = {
+  5,3,306,2493,2512,2655,
+};
+
+static const word row628[5] = {
+  4,3,321,2516,2651,
+};
+
+static const word row629[5] = {
+  4,3,353,2520,2647,
+};
+
+static const word row630[25] = {
+  24,3,357,700,713,732,745,768,781,996,1105,1300,
+  1321,1560,1565,1656,1661,1992,2001,2092,2129,2144,2153,2524,
+  2643,
+};
+
+static const word row631[27] = {
+  26,3,361,436,441,696,717,728,749,764,801,992,
+  1109,1296,1321,1556,1565,1656,1661,1992,2005,2088,2133,2140,
+  2153,2528,2639,
+};
+
+static const word row632[21] = {
+  20,3,365,432,441,692,805,988,1113,1292,1321,1552,
+  1569,1656,1661,1992,2009,2080,2157,2532,2635,
+};
+
+static const word row633[26] = {
+  25,3,369,428,441,688,809,984,1117,1288,1321,1548,
+  1573,1596,1609,1656,1661,1992,2013,2076,2161,2172,2181,2536,
+  2578,2611,
+};
+
+static const word row634[26] = {
+  25,3,373,424,441,684,813,980,1121,1284,1321,1544,
+  1577,1592,1613,1656,1661,1992,2017,2072,2165,2172,2185,2540,
+  2574,2611,
+};
+
+static const word row635[24] = {
+  23,3,377,420,441,680,817,976,1125,1280,1321,1540,
+  1617,1656,1661,1992,2021,2068,2169,2172,2185,2544,2570,2611,
+};
+
+static const word row636[22] = {
+  21,3,381,416,441,676,821,972,1129,1276,1321,1536,
+  1621,1656,1661,1992,2041,2064,2185,2548,2566,2611,
+};
+
+static const word row637[26] = {
+  25,3,385,412,441,664,825,968,1133,1272,1321,1532,
+  1621,1656,1661,1756,1777,1992,2045,2056,2189,2300,2317,2552,
+  2562,2611,
+};
+
+static const word row638[23] = {
+  22,3,389,411,441,655,829,967,1137,1271,1321,1531,
+  1621,1659,1661,1747,1781,1995,2193,2303,2317,2558,2611,
+};
+
+static const word row639[5] = {
+  4,3,2561,2598,2611,
+};
+
+static const word row640[6] = {
+  5,3,2556,2565,2594,2611,
+};
+
+static const word row641[6] = {
+  5,3,2556,2569,2590,2611,
+};
+
+static const word row642[6] = {
+  5,3,2556,2573,2586,2611,
+};
+
+static const word row643[6] = {
+  5,3,2556,2577,2582,2611,
+};
+
+static const word row644[4] = {
+  3,3,2556,2631,
+};
+
+static const word row645[4] = {
+  3,3,2584,2627,
+};
+
+static const word row646[5] = {
+  4,3,2581,2588,2623,
+};
+
+static const word row647[5] = {
+  4,3,2581,2592,2619,
+};
+
+static const word row648[6] = {
+  5,3,2581,2596,2606,2611,
+};
+
+static const word row649[5] = {
+  4,3,2581,2602,2611,
+};
+
+static const word row650[4] = {
+  3,3,2605,2611,
+};
+
+static const word row651[4] = {
+  3,3,2600,2615,
+};
+
+static const word row652[27] = {
+  26,3,393,407,441,651,833,963,1141,1267,1321,1415,
+  1421,1527,1629,1659,1661,1743,1785,1851,1853,1995,2197,2299,
+  2318,2613,2675,
+};
+
+static const word row653[24] = {
+  23,3,389,408,441,652,829,964,1137,1268,1321,1528,
+  1621,1656,1661,1744,1781,1992,2193,2300,2318,2608,2617,2672,
+};
+
+static const word row654[26] = {
+  25,3,385,412,441,664,825,968,1133,1272,1321,1532,
+  1621,1656,1661,1756,1777,1992,2045,2056,2189,2300,2318,2608,
+  2621,2672,
+};
+
+static const word row655[22] = {
+  21,3,381,416,441,676,821,972,1129,1276,1321,1536,
+  1621,1656,1661,1992,2041,2064,2186,2608,2625,2672,
+};
+
+static const word row656[24] = {
+  23,3,377,420,441,680,817,976,1125,1280,1321,1540,
+  1617,1656,1661,1992,2021,2068,2169,2172,2186,2608,2629,2672,
+};
+
+static const word row657[26] = {
+  25,3,373,424,441,684,813,980,1121,1284,1321,1544,
+  1577,1592,1613,1656,1661,1992,2017,2072,2165,2172,2186,2608,
+  2633,2672,
+};
+
+static const word row658[26] = {
+  25,3,369,428,441,688,809,984,1117,1288,1321,1548,
+  1573,1596,1609,1656,1661,1992,2013,2076,2161,2172,2182,2608,
+  2637,2672,
+};
+
+static const word row659[22] = {
+  21,3,365,432,441,692,805,988,1113,1292,1321,1552,
+  1569,1656,1661,1992,2009,2080,2158,2608,2641,2672,
+};
+
+static const word row660[28] = {
+  27,3,361,436,441,696,717,728,749,764,801,992,
+  1109,1296,1321,1556,1565,1656,1661,1992,2005,2088,2133,2140,
+  2154,2608,2645,2672,
+};
+
+static const word row661[26] = {
+  25,3,357,700,713,732,745,768,781,996,1105,1300,
+  1321,1560,1565,1656,1661,1992,2001,2092,2129,2144,2154,2608,
+  2649,2672,
+};
+
+static const word row662[6] = {
+  5,3,354,2608,2653,2672,
+};
+
+static const word row663[6] = {
+  5,3,322,2608,2657,2672,
+};
+
+static const word row664[6] = {
+  5,3,322,2608,2661,2672,
+};
+
+static const word row665[6] = {
+  5,3,322,2608,2665,2672,
+};
+
+static const word row666[6] = {
+  5,3,322,2608,2669,2672,
+};
+
+static const word row667[4] = {
+  3,3,322,2608,
+};
+
+static const word row668[4] = {
+  3,3,290,2493,
+};
+
+static const word row669[5] = {
+  4,3,290,2495,2672,
+};
+
+static const word row670[2] = {
+  1,0,
+};
+
+static const word row671[2] = {
+  1,0,
+};
+
+#ifdef PATHDB_MMC3
+#pragma rodata-name (pop)
+#endif
+
+const word pathdb_order[PATHDB_CELLS] = {
+  65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,
+  65535,0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,65535,
+  65535,667,666,665,664,663,662,661,660,659,658,657,656,655,654,653,652,65535,53,54,55,56,57,58,59,60,61,62,65535,31,30,65535,
+  65535,623,624,625,626,627,628,629,630,631,632,633,634,635,636,637,638,65535,52,65535,65535,65,64,65535,65535,63,65535,65535,65535,65535,32,65535,
+  65535,622,621,620,619,618,65535,65535,65535,65535,65535,644,643,642,641,640,639,65535,45,44,43,42,41,40,39,38,37,36,35,34,33,65535,
+  65535,589,590,591,592,593,594,595,596,597,598,65535,645,646,647,648,649,65535,46,47,48,65535,66,67,68,69,70,71,65535,669,668,65535,
+  65535,588,65535,617,611,612,613,614,615,616,599,600,65535,65535,65535,651,650,65535,65535,51,49,50,65535,65535,65535,65535,65535,72,73,74,75,65535,
+  65535,586,587,65535,610,609,608,607,606,605,604,601,602,603,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,79,78,77,76,65535,
+  65535,585,584,583,65535,120,119,118,117,116,115,114,113,112,111,110,99,100,101,102,103,104,105,106,107,108,109,80,81,82,83,65535,
+  65535,579,580,581,582,121,122,123,124,125,126,127,128,129,130,65535,98,97,96,95,94,93,92,91,90,89,88,87,86,85,84,65535,
+  65535,141,140,139,138,137,136,135,134,133,132,131,65535,65535,65535,572,65535,573,574,65535,542,541,540,539,538,521,522,523,524,525,526,65535,
+  65535,142,65535,65535,561,560,559,558,557,556,555,554,553,552,551,550,549,548,547,546,515,516,517,518,519,520,65535,65535,65535,65535,527,65535,
+  65535,143,144,145,146,147,148,149,150,151,65535,562,563,564,565,566,567,568,512,513,514,65535,545,544,543,65535,532,531,530,529,528,65535,
+  65535,495,494,493,492,489,490,491,65535,152,153,154,155,65535,571,570,569,65535,511,510,509,508,65535,65535,65535,65535,533,534,535,536,537,65535,
+  65535,496,497,65535,65535,488,65535,65535,65535,65535,464,463,156,157,158,159,160,161,162,163,65535,507,506,505,504,503,502,501,500,499,498,65535,
+  65535,481,482,483,484,485,486,487,65535,465,454,455,456,457,458,459,460,461,462,164,165,166,167,168,169,170,171,172,173,174,175,65535,
+  65535,475,474,473,472,471,470,468,469,65535,453,452,451,450,449,65535,65535,65535,65535,442,441,440,65535,575,65535,65535,65535,179,178,177,176,65535,
+  65535,476,477,478,479,480,65535,467,466,425,426,427,428,65535,448,447,446,445,444,443,438,439,65535,576,65535,65535,189,180,181,182,183,65535,
+  65535,416,417,418,419,420,421,422,423,424,65535,65535,429,430,431,432,433,434,435,436,437,65535,65535,577,578,65535,188,187,186,185,184,65535,
+  65535,415,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,190,191,192,65535,
+  65535,222,221,220,219,218,217,216,215,214,213,212,211,210,209,208,207,206,205,204,203,202,201,200,199,198,197,196,195,194,193,65535,
+  65535,223,224,225,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,414,65535,
+  65535,413,412,226,227,228,229,230,231,232,233,234,235,236,237,238,239,240,241,242,243,244,245,246,247,248,249,250,251,252,253,65535,
+  65535,337,338,339,340,341,342,343,344,345,346,347,348,349,350,351,352,353,65535,404,403,402,401,400,65535,65535,65535,257,256,255,254,65535,
+  65535,336,65535,367,366,365,364,363,362,361,360,359,358,357,356,355,354,65535,670,65535,396,397,398,399,65535,671,65535,258,259,260,261,65535,
+  65535,335,334,333,65535,368,369,370,371,372,373,65535,65535,65535,65535,407,406,405,65535,395,394,393,392,391,65535,65535,65535,265,264,263,262,65535,
+  65535,330,331,332,65535,411,410,409,65535,408,374,375,376,377,378,379,380,381,382,383,384,385,386,387,388,389,390,266,267,268,269,65535,
+  65535,299,298,297,296,295,294,293,292,291,290,289,288,287,286,285,284,283,282,281,280,279,278,277,276,275,274,273,272,271,270,65535,
+  65535,300,301,302,303,304,305,306,307,308,309,310,311,312,313,314,315,316,317,318,319,320,321,322,323,324,325,326,327,328,329,65535,
+  65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,
+};
+
+const word pathdb_component_end[3] = {
+  670,671,672,
+};
+
+const word* const pathdb_row[672] = {
+  row0, row1, row2, row3, row4, row5, row6, row7,
+  row8, row9, row10, row11, row12, row13, row14, row15,
+  row16, row17, row18, row19, row20, row21, row22, row23,
+  row24, row25, row26, row27, row28, row29, row30, row31,
+  row32, row33, row34, row35, row36, row37, row38, row39,
+  row40, row41, row42, row43, row44, row45, row46, row47,
+  row48, row49, row50, row51, row52, row53, row54, row55,
+  row56, row57, row58, row59, row60, row61, row62, row63,
+  row64, row65, row66, row67, row68, row69, row70, row71,
+  row72, row73, row74, row75, row76, row77, row78, row79,
+  row80, row81, row82, row83, row84, row85, row86, row87,
+  row88, row89, row90, row91, row92, row93, row94, row95,
+  row96, row97, row98, row99, row100, row101, row102, row103,
+  row104, row105, row106, row107, row108, row109, row110, row111,
+  row112, row113, row114, row115, row116, row117, row118, row119,
+  row120, row121, row122, row123, row124, row125, row126, row127,
+  row128, row129, row130, row131, row132, row133, row134, row135,
+  row136, row137, row138, row139, row140, row141, row142, row143,
+  row144, row145, row146, row147, row148, row149, row150, row151,
+  row152, row153, row154, row155, row156, row157, row158, row159,
+  row160, row161, row162, row163, row164, row165, row166, row167,
+  row168, row169, row170, row171, row172, row173, row174, row175,
+  row176, row177, row178, row179, row180, row181, row182, row183,
+  row184, row185, row186, row187, row188, row189, row190, row191,
+  row192, row193, row194, row195, row196, row197, row198, row199,
+  row200, row201, row202, row203, row204, row205, row206, row207,
+  row208, row209, row210, row211, row212, row213, row214, row215,
+  row216, row217, row218, row219, row220, row221, row222, row223,
+  row224, row225, row226, row227, row228, row229, row230, row231,
+  row232, row233, row234, row235, row236, row237, row238, row239,
+  row240, row241, row242, row243, row244, row245, row246, row247,
+  row248, row249, row250, row251, row252, row253, row254, row255,
+  row256, row257, row258, row259, row260, row261, row262, row263,
+  row264, row265, row266, row267, row268, row269, row270, row271,
+  row272, row273, row274, row275, row276, row277, row278, row279,
+  row280, row281, row282, row283, row284, row285, row286, row287,
+  row288, row289, row290, row291, row292, row293, row294, row295,
+  row296, row297, row298, row299, row300, row301, row302, row303,
+  row304, row305, row306, row307, row308, row309, row310, row311,
+  row312, row313, row314, row315, row316, row317, row318, row319,
+  row320, row321, row322, row323, row324, row325, row326, row327,
+  row328, row329, row330, row331, row332, row333, row334, row335,
+  row336, row337, row338, row339, row340, row341, row342, row343,
+  row344, row345, row346, row347, row348, row349, row350, row351,
+  row352, row353, row354, row355, row356, row357, row358, row359,
+  row360, row361, row362, row363, row364, row365, row366, row367,
+  row368, row369, row370, row371, row372, row373, row374, row375,
+  row376, row377, row378, row379, row380, row381, row382, row383,
+  row384, row385, row386, row387, row388, row389, row390, row391,
+  row392, row393, row394, row395, row396, row397, row398, row399,
+  row400, row401, row402, row403, row404, row405, row406, row407,
+  row408, row409, row410, row411, row412, row413, row414, row415,
+  row416, row417, row418, row419, row420, row421, row422, row423,
+  row424, row425, row426, row427, row428, row429, row430, row431,
+  row432, row433, row434, row435, row436, row437, row438, row439,
+  row440, row441, row442, row443, row444, row445, row446, row447,
+  row448, row449, row450, row451, row452, row453, row454, row455,
+  row456, row457, row458, row459, row460, row461, row462, row463,
+  row464, row465, row466, row467, row468, row469, row470, row471,
+  row472, row473, row474, row475, row476, row477, row478, row479,
+  row480, row481, row482, row483, row484, row485, row486, row487,
+  row488, row489, row490, row491, row492, row493, row494, row495,
+  row496, row497, row498, row499, row500, row501, row502, row503,
+  row504, row505, row506, row507, row508, row509, row510, row511,
+  row512, row513, row514, row515, row516, row517, row518, row519,
+  row520, row521, row522, row523, row524, row525, row526, row527,
+  row528, row529, row530, row531, row532, row533, row534, row535,
+  row536, row537, row538, row539, row540, row541, row542, row543,
+  row544, row545, row546, row547, row548, row549, row550, row551,
+  row552, row553, row554, row555, row556, row557, row558, row559,
+  row560, row561, row562, row563, row564, row565, row566, row567,
+  row568, row569, row570, row571, row572, row573, row574, row575,
+  row576, row577, row578, row579, row580, row581, row582, row583,
+  row584, row585, row586, row587, row588, row589, row590, row591,
+  row592, row593, row594, row595, row596, row597, row598, row599,
+  row600, row601, row602, row603, row604, row605, row606, row607,
+  row608, row609, row610, row611, row612, row613, row614, row615,
+  row616, row617, row618, row619, row620, row621, row622, row623,
+  row624, row625, row626, row627, row628, row629, row630, row631,
+  row632, row633, row634, row635, row636, row637, row638, row639,
+  row640, row641, row642, row643, row644, row645, row646, row647,
+  row648, row649, row650, row651, row652, row653, row654, row655,
+  row656, row657, row658, row659, row660, row661, row662, row663,
+  row664, row665, row666, row667, row668, row669, row670, row671,
+};
+
+const word pathdb_bank_end[3] = { 246, 587, 672, };
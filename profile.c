@@ -0,0 +1,68 @@
+/*
+============================================================
+Frame Profiler - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#include "profile.h"
+
+/* Lag counter sprite: "L" and three digits, top right */
+#define HUD_X           216
+#define HUD_Y           8
+#define HUD_ATTR        3
+#define HUD_MAX         999
+
+uint16_t         profile_lag;
+
+/* nesclock() when the last wait ended */
+static uint8_t   last_frame;
+static uint8_t   frames;
+static uint16_t  n;
+static uint8_t   digit;
+
+void __fastcall__ profile_wait_nmi(void) {
+  /* Any vblank since the last wait was a frame without an update */
+  frames = nesclock() - last_frame;
+  if (frames) profile_lag += frames;
+  ppu_wait_nmi();
+  last_frame = nesclock();
+}
+
+/* Decimal digit of n for the given power of ten (no divides) */
+static void next_digit(uint16_t unit) {
+  digit = '0';
+  while (n >= unit) {
+    n -= unit;
+    ++digit;
+  }
+}
+
+uint8_t __fastcall__ profile_draw(uint8_t sprid) {
+  n = profile_lag < HUD_MAX ? profile_lag : HUD_MAX;
+  sprid = oam_spr(HUD_X, HUD_Y, 'L', HUD_ATTR, sprid);
+  next_digit(100);
+  sprid = oam_spr(HUD_X + 8, HUD_Y, digit, HUD_ATTR, sprid);
+  next_digit(10);
+  sprid = oam_spr(HUD_X + 16, HUD_Y, digit, HUD_ATTR, sprid);
+  next_digit(1);
+  return oam_spr(HUD_X + 24, HUD_Y, digit, HUD_ATTR, sprid);
+}
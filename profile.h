@@ -0,0 +1,71 @@
+/*
+============================================================
+Frame Profiler - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include "neslib.h"
+#include <inttypes.h>
+
+/*
+  Raster-bar profiling: the PPU mask emphasis and greyscale bits
+  are set while a subsystem runs, so the scanlines drawn meanwhile
+  show its share of the frame. Untinted lines are idle time.
+
+  Define PROFILE before including this file (see main.c); without
+  it the macros below compile to nothing.
+*/
+
+/* Normal rendering (background and sprites, left edge included) */
+#define PROFILE_MASK    (MASK_BG | MASK_SPR | MASK_EDGE_BG | MASK_EDGE_SPR)
+
+/* One color per subsystem */
+#define PROFILE_INPUT   MASK_TINT_RED
+#define PROFILE_SOLVE   MASK_TINT_GREEN
+#define PROFILE_SPRITES MASK_TINT_BLUE
+#define PROFILE_VRAM    MASK_MONO
+
+/* Frames the main loop missed: it was still busy at vblank */
+extern uint16_t profile_lag;
+
+/* ppu_wait_nmi(), counting the frames missed since the last call */
+void __fastcall__ profile_wait_nmi(void);
+
+/* Draws the lag count with sprites at the top right, returns next sprid */
+uint8_t __fastcall__ profile_draw(uint8_t sprid);
+
+#ifdef PROFILE
+#define PROFILE_BEGIN(tint_)  ppu_mask(PROFILE_MASK | (tint_))
+#define PROFILE_END()         ppu_mask(PROFILE_MASK)
+#define PROFILE_WAIT_NMI()    profile_wait_nmi()
+#define PROFILE_DRAW(sprid_)  (sprid_) = profile_draw(sprid_)
+#else
+#define PROFILE_BEGIN(tint_)
+#define PROFILE_END()
+#define PROFILE_WAIT_NMI()    ppu_wait_nmi()
+#define PROFILE_DRAW(sprid_)
+#endif
+
+#endif // profile.h
@@ -0,0 +1,128 @@
+/*
+============================================================
+Solver Contexts - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#include "solver.h"
+#include "astar.h"
+#include "dfs.h"
+#include "idastar.h"
+#include "lrta.h"
+#include "swamp.h"
+#include "wram.h"
+#include <string.h>
+
+/* Static variables */
+static SOLVER_LOCAL SolverPath* out;
+static SOLVER_LOCAL int16_t     count;
+static SOLVER_LOCAL uint16_t    i;
+static SOLVER_LOCAL uint8_t     x, y, dir;
+static SOLVER_LOCAL bool        swapped;
+static SOLVER_LOCAL uint8_t     saved_map;
+
+/* The caller's grid and swamps, put back after a context's search */
+static SOLVER_LOCAL uint8_t saved_solid[GRID_BYTES];
+static SOLVER_LOCAL uint8_t saved_swamp[GRID_BYTES];
+
+/* Unpacks idastar_path straight into the caller's buffers */
+static void copy_idastar(uint8_t sx, uint8_t sy) {
+  x = sx;
+  y = sy;
+  out->x[0] = x;
+  out->y[0] = y;
+  for (i = 1; i < (uint16_t)count; ++i) {
+    dir = IDASTAR_STEP(i - 1);
+    x += grid_dx[dir];
+    y += grid_dy[dir];
+    out->x[i] = x;
+    out->y[i] = y;
+  }
+}
+
+byte __fastcall__ solver_run(register SolverContext* ctx) {
+  out = ctx->path;
+  out->count = 0;
+
+  if (ctx->grid->width != GRID_SIZE_X || ctx->grid->height != GRID_SIZE_Y) {
+    return ctx->status = SOLVER_BAD_GRID;
+  }
+  if (ctx->solver > SOLVER_LRTA) {
+    return ctx->status = SOLVER_BAD_SOLVER;
+  }
+
+  swapped = ctx->grid->solid && ctx->grid->solid != grid_solid;
+  if (swapped) {
+    memcpy(saved_solid, grid_solid, GRID_BYTES);
+    memcpy(saved_swamp, swamp_mask, GRID_BYTES);
+    memcpy(grid_solid, ctx->grid->solid, GRID_BYTES);
+    swamp_clear();
+    /* Not area any more: A* leaves the landmarks out */
+    saved_map = grid_map;
+    grid_map = GRID_MAP_OTHER;
+    /* What LRTA* learned on the caller's grid does not hold here */
+    wram_owner = WRAM_OWNER_NONE;
+  }
+
+  switch (ctx->solver) {
+    case SOLVER_ASTAR:
+      count = solve_astar(ctx->sx, ctx->sy, ctx->dx, ctx->dy);
+      break;
+    case SOLVER_DFS:
+      count = solve_dfs(ctx->sx, ctx->sy, ctx->dx, ctx->dy);
+      break;
+    case SOLVER_IDASTAR:
+      count = solve_idastar(ctx->sx, ctx->sy, ctx->dx, ctx->dy);
+      break;
+    case SOLVER_LRTA:
+      count = solve_lrta(ctx->sx, ctx->sy, ctx->dx, ctx->dy);
+      break;
+  }
+
+  if (swapped) {
+    memcpy(grid_solid, saved_solid, GRID_BYTES);
+    memcpy(swamp_mask, saved_swamp, GRID_BYTES);
+    grid_map = saved_map;
+    /* ...nor what it learned here, there */
+    wram_owner = WRAM_OWNER_NONE;
+  }
+
+  if (count <= 0) {
+    if (ctx->solver == SOLVER_LRTA && lrta_status == LRTA_TOO_LONG) {
+      return ctx->status = SOLVER_TOO_LONG;
+    }
+    return ctx->status = SOLVER_NO_PATH;
+  }
+  if (out->x) {
+    if ((uint16_t)count > out->capacity) {
+      return ctx->status = SOLVER_TOO_LONG;
+    }
+    if (ctx->solver == SOLVER_IDASTAR) {
+      copy_idastar(ctx->sx, ctx->sy);
+    } else {
+      memcpy(out->x, waypointX, count);
+      memcpy(out->y, waypointY, count);
+    }
+  }
+  out->count = count;
+  return ctx->status = SOLVER_FOUND;
+}
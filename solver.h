@@ -0,0 +1,113 @@
+/*
+============================================================
+Solver Contexts - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#ifndef SOLVER_H
+#define SOLVER_H
+
+#include "neslib.h"
+#include "grid.h"
+#include <inttypes.h>
+
+/*
+  Caller-owned searches: a context names the grid to search, the
+  two end cells and the buffers the path goes to, so that several
+  requests (one per actor, say) can be pending at once and each
+  gets its own result.
+
+  On the NES this is a thin wrapper over the shared solver state:
+  the solvers have one set of zero page variables and WRAM tables,
+  so contexts only ever run one after the other. solver_run()
+  swaps the context's grid in, runs one search to completion,
+  copies the path out and puts the caller's grid_solid and swamps
+  back. The save area for that costs 2 x GRID_BYTES of RAM for as
+  long as solver.c is linked, which main.c does not do. In host
+  builds that state is per thread (see SOLVER_LOCAL in grid.h), so
+  one thread per core can run contexts side by side.
+*/
+
+/* Solvers a context can use */
+#define SOLVER_ASTAR      0
+#define SOLVER_DFS        1
+#define SOLVER_IDASTAR    2
+#define SOLVER_LRTA       3  /* One whole trip, see lrta.h */
+
+/*
+  Not available through a context: solve_nearest() takes a set of
+  targets rather than one goal, subgoal_data.c and pathdb_data.c
+  only describe area.
+*/
+
+/* solver_run() results */
+#define SOLVER_FOUND      0
+#define SOLVER_NO_PATH    1
+#define SOLVER_TOO_LONG   2  /* Path longer than the output buffer, */
+                             /* or an LRTA* trip over WAYPOINT_COUNT */
+#define SOLVER_BAD_GRID   3  /* Not GRID_SIZE_X x GRID_SIZE_Y       */
+#define SOLVER_BAD_SOLVER 4
+
+/* solid = NULL searches grid_solid as it is */
+typedef struct SolverGrid {
+  const uint8_t* solid;  /* 1 = solid, grid_solid layout */
+  uint8_t width;
+  uint8_t height;
+} SolverGrid;
+
+/*
+  x = NULL leaves the path where the solver wrote it (waypointX/Y,
+  or only idastar_path with IDASTAR_NO_WAYPOINTS).
+*/
+typedef struct SolverPath {
+  uint8_t* x;
+  uint8_t* y;
+  uint16_t capacity;     /* Entries in x and y            */
+  int16_t  count;        /* Nodes written, start included */
+} SolverPath;
+
+typedef struct SolverContext {
+  byte solver;
+  const SolverGrid* grid;
+  SolverPath* path;
+
+  uint8_t sx;
+  uint8_t sy;
+  uint8_t dx;
+  uint8_t dy;
+
+  byte status;           /* Result of the last solver_run() */
+} SolverContext;
+
+/*
+  Runs the context's search and returns its status. A grid with a
+  solid bitmap is searched without swamp pruning or landmarks. It
+  is copied into grid_solid for the search (through the save area
+  in solver.c), and grid_solid, grid_map and swamp_mask are
+  restored after, so plain SOLVE calls keep seeing the caller's
+  grid. SOLVER_LRTA keeps learning across runs on the same goal,
+  and starts over after A* ran (see wram_owner) or on such a grid. The solver must have been initialized (in each
+  thread, on the host).
+*/
+byte __fastcall__ solver_run(SolverContext* ctx);
+
+#endif // solver.h
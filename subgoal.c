@@ -0,0 +1,289 @@
+/*
+============================================================
+Subgoal Graph Search - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#include "subgoal.h"
+#include "vis.h"
+#include <string.h>
+
+/* subgoal_slot: not reached yet, heap slot (1..), or closed */
+#define SLOT_NONE       0
+#define SLOT_CLOSED     0xFF
+
+#if SUBGOAL_MAX + 2 >= SLOT_CLOSED
+#error "SUBGOAL_MAX leaves no room for the start and goal nodes"
+#endif
+
+/* Cell bitmaps, laid out like grid_solid */
+#define BIT_AT(a_, x_, y_) ( \
+  (a_)[GRID_BYTE_AT(x_, y_)] & grid_bit[(x_) & 7] \
+)
+
+#define BIT_SET(a_, x_, y_) ( \
+  (a_)[GRID_BYTE_AT(x_, y_)] |= grid_bit[(x_) & 7] \
+)
+
+#define BIT_CLEAR(a_, x_, y_) ( \
+  (a_)[GRID_BYTE_AT(x_, y_)] &= (uint8_t)~grid_bit[(x_) & 7] \
+)
+
+#define F_SCORE(n_) ( \
+  (uint16_t)(subgoal_f_lo[(n_)] | (subgoal_f_hi[(n_)] << 8)) \
+)
+
+/* Static variables, hot ones in the zero page */
+#pragma bss-name (push, "ZEROPAGE")
+static SOLVER_LOCAL uint8_t   x, y;
+static SOLVER_LOCAL int8_t    qx, qy;
+static SOLVER_LOCAL uint8_t   node, item, above, last;
+static SOLVER_LOCAL uint8_t   hole, child, count;
+static SOLVER_LOCAL uint16_t  key, g;
+#pragma bss-name (pop)
+
+static SOLVER_LOCAL uint8_t   startX, startY, destX, destY;
+static SOLVER_LOCAL uint8_t   start_node, goal_node;
+static SOLVER_LOCAL uint8_t   ax, ay, bx, by;
+static SOLVER_LOCAL uint8_t   hops;
+static SOLVER_LOCAL uint16_t  e, e_end;
+static SOLVER_LOCAL int16_t   num_nodes;
+
+SOLVER_LOCAL uint16_t         subgoal_expanded;
+
+/* (x, y) = cell of node n: a subgoal, the start or the goal */
+static void node_cell(uint8_t n) {
+  if (n < subgoal_count) {
+    x = subgoal_x[n];
+    y = subgoal_y[n];
+  } else if (n == start_node) {
+    x = startX;
+    y = startY;
+  } else {
+    x = destX;
+    y = destY;
+  }
+}
+
+/*
+  Marks in bits every cell h-reachable from (x0, y0), a quadrant at
+  a time: a cell is reached through its neighbor toward (x0, y0) on
+  either axis. Cells on the axes belong to two quadrants and come
+  out the same in both. A row with nothing reached ends a quadrant.
+*/
+static void flood(uint8_t* bits, uint8_t x0, uint8_t y0) {
+  memset(bits, 0, GRID_BYTES);
+  for (qy = -1; qy <= 1; qy += 2) {
+    for (qx = -1; qx <= 1; qx += 2) {
+      for (y = y0; y < GRID_SIZE_Y; y += qy) {
+        count = 0;
+        for (x = x0; x < GRID_SIZE_X; x += qx) {
+          if (GRID_SOLID(x, y)) continue;
+          if ((x == x0 && y == y0) ||
+              (x != x0 && BIT_AT(bits, x - qx, y)) ||
+              (y != y0 && BIT_AT(bits, x, y - qy))) {
+            BIT_SET(bits, x, y);
+            count = 1;
+          }
+        }
+        if (!count) break;
+      }
+    }
+  }
+}
+
+/*
+  Appends the cells after (ax, ay) on a path of Manhattan length to
+  (bx, by), which must be h-reachable: marks the cells of the box
+  between them that still reach (bx, by) that way, working back
+  from it, then walks the marks from (ax, ay).
+*/
+static void add_segment(void) {
+  qx = ax < bx ? -1 : 1;
+  qy = ay < by ? -1 : 1;
+  for (y = by; ; y += qy) {
+    for (x = bx; ; x += qx) {
+      if (!GRID_SOLID(x, y) &&
+          ((x == bx && y == by) ||
+           (x != bx && BIT_AT(subgoal_segment, x - qx, y)) ||
+           (y != by && BIT_AT(subgoal_segment, x, y - qy)))) {
+        BIT_SET(subgoal_segment, x, y);
+      } else {
+        BIT_CLEAR(subgoal_segment, x, y);
+      }
+      if (x == ax) break;
+    }
+    if (y == ay) break;
+  }
+
+  x = ax;
+  y = ay;
+  while (x != bx || y != by) {
+    if (x != bx && BIT_AT(subgoal_segment, x - qx, y)) {
+      x -= qx;
+    } else {
+      y -= qy;
+    }
+    waypointX[num_nodes] = x;
+    waypointY[num_nodes] = y;
+    ++num_nodes;
+  }
+}
+
+/* Puts item at hole and sifts it up by f */
+static void sift_up(void) {
+  key = F_SCORE(item);
+  while (hole > 1) {
+    above = subgoal_heap[hole >> 1];
+    if (F_SCORE(above) <= key) break;
+    subgoal_heap[hole] = above;
+    subgoal_slot[above] = hole;
+    hole >>= 1;
+  }
+  subgoal_heap[hole] = item;
+  subgoal_slot[item] = hole;
+}
+
+/* Takes the node with the smallest f off the heap, into node */
+static void pop(void) {
+  node = subgoal_heap[1];
+  last = subgoal_heap[count];
+  if (!--count) return;
+
+  key = F_SCORE(last);
+  hole = 1;
+  while (hole < 128 && (child = hole << 1) <= count) {
+    if (child < count && F_SCORE(subgoal_heap[child + 1]) < F_SCORE(subgoal_heap[child])) ++child;
+    if (F_SCORE(subgoal_heap[child]) >= key) break;
+    subgoal_heap[hole] = subgoal_heap[child];
+    subgoal_slot[subgoal_heap[hole]] = hole;
+    hole = child;
+  }
+  subgoal_heap[hole] = last;
+  subgoal_slot[last] = hole;
+}
+
+/* Reaches item from node with f = key, unless it has as good */
+static void relax(void) {
+  hole = subgoal_slot[item];
+  if (hole == SLOT_CLOSED) return;
+  if (hole != SLOT_NONE && F_SCORE(item) <= key) return;
+  subgoal_f_lo[item] = (uint8_t)key;
+  subgoal_f_hi[item] = (uint8_t)(key >> 8);
+  subgoal_parent[item] = node;
+  if (hole == SLOT_NONE) hole = ++count;
+  sift_up();
+}
+
+/* Writes the path: the hops back from the goal, then their cells */
+static int16_t trace_path(void) {
+  hops = 0;
+  for (node = goal_node; node != start_node; node = subgoal_parent[node]) {
+    subgoal_heap[hops++] = node;
+  }
+  ax = startX;
+  ay = startY;
+  while (hops) {
+    node_cell(subgoal_heap[--hops]);
+    bx = x;
+    by = y;
+    add_segment();
+    ax = bx;
+    ay = by;
+  }
+  return num_nodes;
+}
+
+void __fastcall__ initialize_subgoal_solver(void) {
+  subgoal_expanded = 0;
+}
+
+int16_t __fastcall__ solve_subgoal(uint8_t sx, uint8_t sy, uint8_t dx, uint8_t dy) {
+  subgoal_expanded = 0;
+  if (sx == dx && sy == dy) return 0;
+  if (sx >= GRID_SIZE_X || dx >= GRID_SIZE_X || sy >= GRID_SIZE_Y || dy >= GRID_SIZE_Y) return 0;
+  if (GRID_SOLID(sx, sy) || GRID_SOLID(dx, dy)) return 0;
+
+  startX = sx;
+  startY = sy;
+  destX = dx;
+  destY = dy;
+  start_node = subgoal_count;
+  goal_node = subgoal_count + 1;
+  waypointX[0] = sx;
+  waypointY[0] = sy;
+  num_nodes = 1;
+
+  /* Straight Manhattan run: no search */
+  flood(subgoal_from_s, sx, sy);
+  if (BIT_AT(subgoal_from_s, dx, dy)) {
+    ax = sx;
+    ay = sy;
+    bx = dx;
+    by = dy;
+    add_segment();
+    return num_nodes;
+  }
+  flood(subgoal_from_g, dx, dy);
+
+  /* The start leads to the subgoals h-reachable from it */
+  memset(subgoal_slot, SLOT_NONE, goal_node + 1);
+  count = 0;
+  node = start_node;
+  for (item = 0; item < subgoal_count; ++item) {
+    x = subgoal_x[item];
+    y = subgoal_y[item];
+    if (!BIT_AT(subgoal_from_s, x, y)) continue;
+    key = ABS_DIFF(x, sx) + ABS_DIFF(y, sy) + ABS_DIFF(x, dx) + ABS_DIFF(y, dy);
+    relax();
+  }
+  subgoal_slot[start_node] = SLOT_CLOSED;
+
+  /* A* over the subgoals, f = g + Manhattan distance to the goal */
+  while (count) {
+    pop();
+    if (node == goal_node) return trace_path();
+    subgoal_slot[node] = SLOT_CLOSED;
+    ++subgoal_expanded;
+
+    ax = subgoal_x[node];
+    ay = subgoal_y[node];
+    VIS_EVENT(VIS_EXPANDED, GRID_INDEX(ax, ay));
+    g = F_SCORE(node) - (ABS_DIFF(ax, dx) + ABS_DIFF(ay, dy));
+
+    /* The goal is h-reachable from here: it costs what f says */
+    if (BIT_AT(subgoal_from_g, ax, ay)) {
+      item = goal_node;
+      key = F_SCORE(node);
+      relax();
+    }
+
+    for (e = subgoal_first[node], e_end = subgoal_first[node + 1]; e < e_end; ++e) {
+      item = subgoal_edge[e];
+      bx = subgoal_x[item];
+      by = subgoal_y[item];
+      key = g + ABS_DIFF(ax, bx) + ABS_DIFF(ay, by) + ABS_DIFF(bx, dx) + ABS_DIFF(by, dy);
+      relax();
+    }
+  }
+  return 0;
+}
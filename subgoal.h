@@ -0,0 +1,66 @@
+/*
+============================================================
+Subgoal Graph Search - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#ifndef SUBGOAL_H
+#define SUBGOAL_H
+
+#include "neslib.h"
+#include "grid.h"
+#include "wram.h"
+#include <inttypes.h>
+
+/*
+  Shortest paths on area through its subgoals: the open cells at
+  the convex corners of walls, the only places where a shortest
+  path needs to turn. tools/subgoals.c finds them and joins the
+  pairs that a path of Manhattan length links (h-reachable), into
+  subgoal_data.c.
+
+  A query floods the cells h-reachable from the start and from the
+  goal, runs A* over the subgoals between them with Manhattan edge
+  costs, and expands each hop of the result into cells. Ends that
+  are h-reachable from each other need no search at all.
+
+  The tables describe area: regenerate them after editing it. They
+  say nothing about world windows (WORLD_MODE).
+*/
+
+/* Subgoals the tables may hold (node ids up to SUBGOAL_MAX + 1) */
+#define SUBGOAL_MAX     250
+
+/* Graph tables (subgoal_data.c) */
+extern const uint8_t  subgoal_count;
+extern const uint8_t  subgoal_x[];
+extern const uint8_t  subgoal_y[];
+extern const uint16_t subgoal_first[];  /* Edges of n: [first[n], first[n + 1]) */
+extern const uint8_t  subgoal_edge[];
+
+/* Subgoals expanded by the last solve_subgoal() call */
+extern SOLVER_LOCAL uint16_t subgoal_expanded;
+
+void __fastcall__ initialize_subgoal_solver(void);
+int16_t __fastcall__ solve_subgoal(uint8_t sx, uint8_t sy, uint8_t dx, uint8_t dy);
+
+#endif // subgoal.h
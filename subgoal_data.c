@@ -0,0 +1,77 @@
+/* Generated by tools/subgoals.c from area.c -- do not edit */
+#include "subgoal.h"
+
+const uint8_t subgoal_count = 141;
+
+const uint8_t subgoal_x[141] = {
+  16, 18, 27, 29, 18, 21, 22, 25, 30, 5, 11, 12, 18, 20, 21, 22,
+  25, 27, 29, 30, 1, 3, 5, 15, 19, 27, 4, 10, 20, 27, 29, 1,
+  5, 11, 2, 13, 14, 16, 27, 3, 5, 11, 17, 18, 20, 1, 4, 25,
+  30, 9, 11, 15, 17, 18, 20, 22, 24, 1, 4, 7, 9, 12, 14, 16,
+  18, 30, 2, 5, 9, 10, 11, 19, 20, 21, 12, 14, 16, 18, 21, 26,
+  2, 5, 10, 14, 19, 21, 23, 27, 5, 7, 12, 14, 8, 9, 10, 12,
+  14, 19, 20, 27, 1, 5, 7, 12, 14, 23, 28, 1, 3, 28, 30, 3,
+  17, 19, 23, 27, 30, 1, 3, 16, 20, 3, 5, 10, 15, 1, 3, 7,
+  9, 16, 20, 10, 15, 17, 19, 23, 27, 3, 5, 7, 9,
+};
+
+const uint8_t subgoal_y[141] = {
+  1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 7,
+  7, 7, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 10, 10, 10,
+  10, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14,
+  15, 15, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 17, 17, 17, 17,
+  17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 22,
+  22, 22, 22, 22, 22, 23, 23, 23, 23, 24, 24, 24, 24, 25, 25, 25,
+  25, 25, 25, 26, 26, 26, 26, 26, 26, 27, 27, 27, 27,
+};
+
+/* Edges of subgoal n: subgoal_edge[subgoal_first[n]..subgoal_first[n + 1]) */
+const uint16_t subgoal_first[142] = {
+  0, 4, 7, 10, 12, 15, 18, 21, 24, 26, 28, 31,
+  34, 37, 41, 44, 47, 50, 53, 56, 59, 61, 64, 69,
+  71, 74, 76, 80, 85, 87, 90, 93, 96, 101, 105, 108,
+  111, 113, 116, 121, 125, 132, 136, 139, 142, 146, 151, 156,
+  160, 165, 170, 175, 179, 183, 187, 191, 193, 195, 199, 204,
+  208, 211, 215, 219, 224, 228, 233, 237, 242, 244, 247, 251,
+  255, 258, 260, 265, 269, 272, 276, 279, 283, 286, 289, 294,
+  298, 303, 307, 311, 315, 318, 321, 325, 328, 331, 333, 336,
+  339, 342, 345, 347, 349, 353, 356, 359, 361, 363, 364, 367,
+  370, 373, 376, 379, 382, 385, 388, 392, 395, 397, 400, 404,
+  408, 411, 414, 418, 422, 426, 428, 431, 434, 438, 442, 445,
+  449, 453, 456, 459, 463, 465, 467, 470, 473, 476,
+};
+
+const uint8_t subgoal_edge[476] = {
+  1, 10, 11, 23, 0, 2, 4, 1, 3, 7, 2, 8, 1, 5, 12, 4,
+  6, 14, 5, 7, 15, 2, 6, 16, 3, 19, 10, 22, 0, 9, 11, 0,
+  10, 23, 4, 13, 24, 12, 14, 24, 28, 5, 13, 15, 6, 14, 16, 7,
+  15, 17, 16, 18, 25, 17, 19, 30, 8, 18, 48, 21, 31, 20, 22, 26,
+  9, 21, 26, 27, 32, 0, 11, 12, 13, 28, 17, 29, 21, 22, 27, 32,
+  22, 26, 32, 33, 49, 13, 24, 25, 30, 38, 18, 29, 48, 20, 34, 45,
+  22, 26, 27, 33, 40, 27, 32, 35, 41, 31, 39, 45, 33, 36, 41, 35,
+  37, 36, 38, 42, 29, 37, 44, 47, 48, 34, 40, 45, 46, 32, 39, 41,
+  46, 49, 59, 67, 33, 35, 40, 50, 37, 43, 52, 42, 44, 53, 38, 43,
+  47, 54, 31, 34, 39, 46, 57, 39, 40, 45, 49, 58, 38, 44, 48, 56,
+  19, 30, 38, 47, 65, 27, 40, 46, 50, 60, 41, 49, 51, 61, 70, 50,
+  52, 62, 63, 42, 51, 53, 63, 43, 52, 54, 64, 44, 53, 55, 72, 54,
+  56, 47, 55, 45, 58, 66, 100, 46, 57, 59, 66, 67, 40, 58, 60, 67,
+  49, 59, 68, 50, 62, 70, 74, 51, 61, 63, 75, 51, 52, 62, 64, 76,
+  53, 63, 71, 77, 48, 79, 87, 106, 110, 57, 58, 67, 80, 40, 58, 59,
+  66, 81, 60, 69, 68, 70, 82, 50, 61, 69, 74, 64, 72, 77, 84, 54,
+  71, 73, 72, 78, 61, 70, 75, 82, 90, 62, 74, 76, 83, 63, 75, 77,
+  64, 71, 76, 84, 73, 79, 85, 65, 78, 86, 87, 66, 81, 100, 67, 80,
+  88, 69, 74, 83, 90, 94, 75, 82, 84, 91, 71, 77, 83, 85, 97, 78,
+  84, 86, 98, 79, 85, 87, 105, 65, 79, 86, 99, 81, 89, 101, 88, 92,
+  102, 74, 82, 91, 95, 83, 90, 96, 89, 93, 102, 92, 94, 82, 93, 95,
+  90, 94, 103, 91, 97, 104, 84, 96, 98, 85, 97, 87, 106, 57, 80, 101,
+  107, 88, 100, 102, 89, 92, 101, 95, 104, 96, 103, 86, 65, 99, 109, 100,
+  108, 117, 107, 109, 111, 106, 108, 110, 65, 109, 116, 108, 112, 118, 111, 113,
+  119, 112, 114, 120, 113, 115, 120, 135, 114, 116, 136, 110, 115, 107, 118, 125,
+  111, 117, 119, 121, 112, 118, 124, 129, 113, 114, 130, 118, 122, 126, 121, 123,
+  127, 138, 122, 124, 128, 131, 119, 123, 129, 132, 117, 126, 121, 125, 137, 122,
+  128, 139, 123, 127, 131, 140, 119, 124, 132, 133, 120, 134, 135, 123, 128, 132,
+  140, 124, 129, 131, 133, 129, 132, 134, 130, 133, 135, 114, 130, 134, 136, 115,
+  135, 126, 138, 122, 137, 139, 127, 138, 140, 128, 131, 139,
+};
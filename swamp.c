@@ -0,0 +1,225 @@
+/*
+============================================================
+Swamp Pruning - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#include "swamp.h"
+#include "wram.h"
+#include <string.h>
+
+/* High byte of the DFS number of a cell not reached yet */
+#define UNSEEN_HI       0xFF
+
+/* swamp_state: next direction to try, and the way back up */
+#define NEXT_DIR(s_)    ((s_) & 7)
+#define BACK_DIR(s_)    ((s_) >> 3)
+
+SOLVER_LOCAL uint8_t          swamp_mask[GRID_BYTES];
+
+/* Hot state lives in the zero page */
+#pragma bss-name (push, "ZEROPAGE")
+static SOLVER_LOCAL uint8_t   x, y;
+static SOLVER_LOCAL uint8_t   nx, ny;
+static SOLVER_LOCAL uint8_t   dir;
+static SOLVER_LOCAL uint16_t  cell;
+static SOLVER_LOCAL uint16_t  next;
+#pragma bss-name (pop)
+
+static SOLVER_LOCAL uint16_t  counter;
+static SOLVER_LOCAL uint16_t  disc, low;
+static SOLVER_LOCAL uint8_t   rootX, rootY;
+
+/* Flood fill state (its own, mark_swamp runs in the middle of the DFS) */
+static SOLVER_LOCAL uint8_t   fx, fy;
+static SOLVER_LOCAL uint8_t   gx, gy;
+static SOLVER_LOCAL uint8_t   fdir;
+static SOLVER_LOCAL uint8_t   top;
+static SOLVER_LOCAL uint8_t*  map;
+
+#define IN_BOUNDS(x_, y_) ((x_) < GRID_SIZE_X && (y_) < GRID_SIZE_Y)
+
+#define CELL_BYTE(x_, y_) GRID_BYTE_AT(x_, y_)
+#define CELL_BIT(x_)      (grid_bit[(x_) & 7])
+
+#define IN_MAP(b_, x_, y_) ( \
+  (b_)[CELL_BYTE(x_, y_)] & CELL_BIT(x_) \
+)
+
+#define DISC(i_) ( \
+  swamp_disc_lo[(i_)] | (swamp_disc_hi[(i_)] << 8) \
+)
+
+#define LOW(i_) ( \
+  swamp_low_lo[(i_)] | (swamp_low_hi[(i_)] << 8) \
+)
+
+#define SET_LOW(i_, v_) ( \
+  swamp_low_lo[(i_)] = (uint8_t)(v_), \
+  swamp_low_hi[(i_)] = (uint8_t)((v_) >> 8) \
+)
+
+#define PUSH(x_, y_) ( \
+  swamp_stack_x[top] = (x_), \
+  swamp_stack_y[top] = (y_), \
+  ++top \
+)
+
+/* Numbers the cell, first seen by the DFS */
+static void visit(void) {
+  swamp_disc_lo[cell] = (uint8_t)counter;
+  swamp_disc_hi[cell] = (uint8_t)(counter >> 8);
+  SET_LOW(cell, counter);
+  ++counter;
+}
+
+/*
+  Marks the swamp entered at (nx, ny) through the door (x, y). At
+  most SWAMP_MAX_CELLS cells: swamps marked earlier (nested ones)
+  are not walked again.
+*/
+static void mark_swamp(void) {
+  top = 0;
+  swamp_mask[CELL_BYTE(nx, ny)] |= CELL_BIT(nx);
+  PUSH(nx, ny);
+  while (top) {
+    --top;
+    fx = swamp_stack_x[top];
+    fy = swamp_stack_y[top];
+    for (fdir = 0; fdir < 4; ++fdir) {
+      gx = fx + grid_dx[fdir];
+      gy = fy + grid_dy[fdir];
+      if (!IN_BOUNDS(gx, gy) || (gx == x && gy == y)) continue;
+      if (IN_MAP(grid_solid, gx, gy) || IN_MAP(swamp_mask, gx, gy)) continue;
+      swamp_mask[CELL_BYTE(gx, gy)] |= CELL_BIT(gx);
+      PUSH(gx, gy);
+    }
+  }
+}
+
+/*
+  Clears the set bits of map connected to (fx, fy). Swamps are
+  nested or apart, so this is one swamp of at most SWAMP_MAX_CELLS;
+  should the stack still fill up, nothing is pruned.
+*/
+static void clear_swamp(void) {
+  if (!IN_MAP(map, fx, fy)) return;
+  top = 0;
+  map[CELL_BYTE(fx, fy)] &= (uint8_t)~CELL_BIT(fx);
+  PUSH(fx, fy);
+  while (top) {
+    --top;
+    x = swamp_stack_x[top];
+    y = swamp_stack_y[top];
+    for (fdir = 0; fdir < 4; ++fdir) {
+      gx = x + grid_dx[fdir];
+      gy = y + grid_dy[fdir];
+      if (!IN_BOUNDS(gx, gy) || !IN_MAP(map, gx, gy)) continue;
+      if (top == SWAMP_MAX_CELLS) {
+        memset(map, 0, GRID_BYTES);
+        return;
+      }
+      map[CELL_BYTE(gx, gy)] &= (uint8_t)~CELL_BIT(gx);
+      PUSH(gx, gy);
+    }
+  }
+}
+
+/*
+  Iterative Tarjan articulation point search. Leaving a cell c for
+  its parent p: if no back edge from c's subtree climbs above p
+  (low(c) >= disc(p)), p is the only way into that subtree, which
+  is the DFS number range [disc(c), counter).
+*/
+void __fastcall__ swamp_analyze(void) {
+  memset(swamp_mask, 0, GRID_BYTES);
+  wram_owner = WRAM_OWNER_SWAMP;
+  memset(swamp_disc_hi, UNSEEN_HI, WAYPOINT_COUNT);
+  counter = 0;
+  
+  for (rootY = 0; rootY < GRID_SIZE_Y; ++rootY) {
+    for (rootX = 0; rootX < GRID_SIZE_X; ++rootX) {
+      if (IN_MAP(grid_solid, rootX, rootY)) continue;
+      cell = GRID_INDEX(rootX, rootY);
+      if (swamp_disc_hi[cell] != UNSEEN_HI) continue;
+      
+      /* New connected area */
+      x = rootX;
+      y = rootY;
+      visit();
+      swamp_state[cell] = 0;
+      
+      for (;;) {
+        dir = NEXT_DIR(swamp_state[cell]);
+        if (dir < 4) {
+          ++swamp_state[cell];
+          nx = x + grid_dx[dir];
+          ny = y + grid_dy[dir];
+          if (!IN_BOUNDS(nx, ny) || IN_MAP(grid_solid, nx, ny)) continue;
+          next = GRID_INDEX(nx, ny);
+          if (swamp_disc_hi[next] == UNSEEN_HI) {
+            /* Tree edge: go down */
+            x = nx;
+            y = ny;
+            cell = next;
+            visit();
+            swamp_state[cell] = (dir ^ 1) << 3;
+          } else {
+            /* Back edge (the edge to the parent does no harm) */
+            disc = DISC(next);
+            if (disc < LOW(cell)) SET_LOW(cell, disc);
+          }
+        } else {
+          /* Every neighbor seen: back to the parent */
+          if (x == rootX && y == rootY) break;
+          low = LOW(cell);
+          disc = DISC(cell);
+          dir = BACK_DIR(swamp_state[cell]);
+          nx = x;
+          ny = y;
+          x += grid_dx[dir];
+          y += grid_dy[dir];
+          cell = GRID_INDEX(x, y);
+          if (low >= DISC(cell) && counter - disc <= SWAMP_MAX_CELLS) {
+            mark_swamp();
+          }
+          if (low < LOW(cell)) SET_LOW(cell, low);
+        }
+      }
+    }
+  }
+}
+
+void __fastcall__ swamp_clear(void) {
+  memset(swamp_mask, 0, GRID_BYTES);
+}
+
+void __fastcall__ swamp_seed(uint8_t* bitmap, uint8_t sx, uint8_t sy, uint8_t dx, uint8_t dy) {
+  memcpy(bitmap, swamp_mask, GRID_BYTES);
+  map = bitmap;
+  fx = sx;
+  fy = sy;
+  clear_swamp();
+  fx = dx;
+  fy = dy;
+  clear_swamp();
+}
@@ -0,0 +1,66 @@
+/*
+============================================================
+Swamp Pruning - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#ifndef SWAMP_H
+#define SWAMP_H
+
+#include "neslib.h"
+#include "grid.h"
+#include <inttypes.h>
+
+/*
+  A swamp is a group of open cells that can only be entered through
+  one door cell: a room with one opening, a dead-end corridor. A
+  shortest path between two cells outside of it never goes in, as
+  it would have to leave through the door it came in by.
+
+  swamp_analyze() finds the swamps of the current grid (the cells
+  behind articulation points, found with one depth-first pass).
+  The solvers then start each search with them already visited or
+  closed, except the swamps holding the start or the goal.
+*/
+
+/* Largest swamp marked, in cells (bounded by the flood stack) */
+#define SWAMP_MAX_CELLS 64
+
+/* Cells in a swamp, same layout as grid_solid */
+extern SOLVER_LOCAL uint8_t swamp_mask[GRID_BYTES];
+
+/*
+  Analyzes grid_solid (needs WRAM: borrows the solver tables). Run
+  it again whenever the grid changes, or call swamp_clear().
+*/
+void __fastcall__ swamp_analyze(void);
+
+/* Forgets the swamps: the solvers search every cell again */
+void __fastcall__ swamp_clear(void);
+
+/*
+  Starts a solver's visited/closed bitmap: swamp_mask, minus the
+  swamps holding (sx, sy) and (dx, dy).
+*/
+void __fastcall__ swamp_seed(uint8_t* bitmap, uint8_t sx, uint8_t sy, uint8_t dx, uint8_t dy);
+
+#endif // swamp.h
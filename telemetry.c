@@ -0,0 +1,102 @@
+/*
+============================================================
+Solve Telemetry - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#include "telemetry.h"
+
+#define MAGIC_0         'T'
+#define MAGIC_1         'L'
+#define NEXT            4
+#define COUNT           5
+#define SUM1            6
+#define SUM2            7
+
+/* Static variables */
+static uint8_t*  rec;
+static uint8_t   sum1, sum2;
+static uint8_t   i;
+
+/* Fletcher-16 of the area, skipping the checksum itself */
+static void checksum(void) {
+  sum1 = 0;
+  sum2 = 0;
+  for (i = 0; i < TELEMETRY_BYTES; ++i) {
+    if (i == SUM1) i = TELEMETRY_HEADER;
+    sum1 += telemetry_wram[i];
+    if (sum1 < telemetry_wram[i]) ++sum1;  /* mod 255 */
+    sum2 += sum1;
+    if (sum2 < sum1) ++sum2;
+  }
+}
+
+static void seal(void) {
+  checksum();
+  telemetry_wram[SUM1] = sum1;
+  telemetry_wram[SUM2] = sum2;
+}
+
+void __fastcall__ telemetry_clear(void) {
+  for (i = 0; i < TELEMETRY_BYTES; ++i) {
+    telemetry_wram[i] = 0;
+  }
+  telemetry_wram[0] = MAGIC_0;
+  telemetry_wram[1] = MAGIC_1;
+  telemetry_wram[2] = TELEMETRY_VERSION;
+  telemetry_wram[3] = TELEMETRY_RECORD;
+  seal();
+}
+
+void __fastcall__ telemetry_init(void) {
+  checksum();
+  if (telemetry_wram[0] != MAGIC_0 || telemetry_wram[1] != MAGIC_1 ||
+      telemetry_wram[2] != TELEMETRY_VERSION ||
+      telemetry_wram[3] != TELEMETRY_RECORD ||
+      telemetry_wram[NEXT] >= TELEMETRY_RECORDS ||
+      telemetry_wram[COUNT] > TELEMETRY_RECORDS ||
+      telemetry_wram[SUM1] != sum1 || telemetry_wram[SUM2] != sum2) {
+    telemetry_clear();
+  }
+}
+
+void __fastcall__ telemetry_log(uint8_t solver,
+                                uint8_t sx, uint8_t sy, uint8_t dx, uint8_t dy,
+                                int16_t nodes, uint16_t work, uint8_t frames) {
+  i = telemetry_wram[NEXT];
+  rec = &telemetry_wram[TELEMETRY_HEADER + i * TELEMETRY_RECORD];
+  rec[0] = sx;
+  rec[1] = sy;
+  rec[2] = dx;
+  rec[3] = dy;
+  rec[4] = solver;
+  rec[5] = frames;
+  rec[6] = (uint8_t)nodes;
+  rec[7] = (uint8_t)((uint16_t)nodes >> 8);
+  rec[8] = (uint8_t)work;
+  rec[9] = (uint8_t)(work >> 8);
+
+  if (++i == TELEMETRY_RECORDS) i = 0;
+  telemetry_wram[NEXT] = i;
+  if (telemetry_wram[COUNT] < TELEMETRY_RECORDS) ++telemetry_wram[COUNT];
+  seal();
+}
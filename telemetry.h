@@ -0,0 +1,74 @@
+/*
+============================================================
+Solve Telemetry - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include "neslib.h"
+#include "wram.h"
+#include <inttypes.h>
+
+/*
+  A record of the last solves, kept in a reserved WRAM area
+  (telemetry_wram) so that it survives resets on battery-backed
+  carts and can be read back from an emulator's save file with
+  tools/telemetry.c.
+
+    0  'T', 'L'   magic
+    2  version
+    3  record size
+    4  next record to write
+    5  records in use
+    6  Fletcher-16 of bytes 0-5 and 8-127 (sum1, sum2)
+    8  records, oldest overwritten first
+
+  Record: sx, sy, dx, dy, solver, frames, path nodes (16 bits),
+  work (16 bits: the solver's expansion counter), little endian.
+*/
+#define TELEMETRY_VERSION   1
+#define TELEMETRY_HEADER    8
+#define TELEMETRY_RECORD    10
+#define TELEMETRY_RECORDS   ((TELEMETRY_BYTES - TELEMETRY_HEADER) / TELEMETRY_RECORD)
+
+/* Solver ids, by SOLVER name (see main.c) */
+#define TELEMETRY_astar     0
+#define TELEMETRY_dfs       1
+#define TELEMETRY_idastar   2
+#define TELEMETRY_pathdb    3
+#define TELEMETRY_lrta      4
+#define TELEMETRY_subgoal   5
+
+/* Keeps a valid record, or starts an empty one */
+void __fastcall__ telemetry_init(void);
+
+/* Clears every record */
+void __fastcall__ telemetry_clear(void);
+
+/* Appends a record for one solve */
+void __fastcall__ telemetry_log(uint8_t solver,
+                                uint8_t sx, uint8_t sy, uint8_t dx, uint8_t dy,
+                                int16_t nodes, uint16_t work, uint8_t frames);
+
+#endif // telemetry.h
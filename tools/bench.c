@@ -0,0 +1,156 @@
+/*
+============================================================
+Benchmark Decoder - Host Tool
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+
+Decodes the benchmark results (bench.h) from a dump of the
+cartridge WRAM at $6000-$7FFF, taken from a ROM built with
+BENCHMARK, and prints them as CSV, one line per query of the
+script, then a total line. cycles_per_work divides a solve's
+cycles by its expansion counter, to compare builds of the same
+solver (the counters differ between solvers). Meant for headless
+emulator runs:
+dump WRAM once the pass count is non-zero. With BENCH_AREA_SCRIPT,
+give the map source the ROM was built with, for its script.
+
+  cc -O2 -o bench tools/bench.c
+  ./bench wram.bin [maps/corpus/maze.c] > bench.csv
+*/
+#include <stdio.h>
+#include <string.h>
+
+/* Same layout as bench.h / wram.h */
+#define WRAM_BASE  0x6000
+#define ADDR       0x7FC0
+#define BYTES      64
+#define HEADER     8
+#define VERSION    1
+#define RECORD     8
+#define QUERIES    ((BYTES - HEADER) / RECORD)
+
+static const char *solver_name[] = {"astar", "dfs", "idastar", "pathdb", "lrta", "subgoal"};
+
+/* Same script as bench.c, unless a map source gives its own */
+static int script[QUERIES][4] = {
+  { 1,  1,  2,  1},
+  {16,  9, 16, 11},
+  { 1, 22, 30, 22},
+  { 1,  1, 30, 28},
+  {17, 28, 16,  6},
+  { 1,  1, 18, 24},
+  {25, 24,  1,  1},
+};
+
+static unsigned char area[BYTES];
+
+/* Reads the bench_script rows of a map source */
+static int load_script(const char *path) {
+  FILE *f = fopen(path, "r");
+  char line[256];
+  int q = 0, in_script = 0;
+
+  if (!f) {
+    perror(path);
+    return 0;
+  }
+  while (q < QUERIES && fgets(line, sizeof(line), f)) {
+    if (strstr(line, "bench_script")) in_script = 1;
+    else if (in_script && sscanf(line, " {%d, %d, %d, %d}", &script[q][0],
+                                 &script[q][1], &script[q][2], &script[q][3]) == 4) ++q;
+  }
+  fclose(f);
+  if (q != QUERIES) {
+    fprintf(stderr, "%s: no benchmark script found\n", path);
+    return 0;
+  }
+  return 1;
+}
+
+int main(int argc, char **argv) {
+  FILE *f;
+  int solver, queries, done, q;
+  unsigned long cycles, total = 0, work, total_work = 0;
+  long frame;
+  const unsigned char *r;
+
+  if (argc < 2 || argc > 3) {
+    fprintf(stderr, "usage: %s wram.bin [map.c] > bench.csv\n", argv[0]);
+    return 1;
+  }
+  if (argc == 3 && !load_script(argv[2])) return 1;
+  f = fopen(argv[1], "rb");
+  if (!f) {
+    perror(argv[1]);
+    return 1;
+  }
+  if (fseek(f, ADDR - WRAM_BASE, SEEK_SET) || fread(area, 1, BYTES, f) != BYTES) {
+    fprintf(stderr, "%s: too short for a WRAM dump\n", argv[1]);
+    return 1;
+  }
+  fclose(f);
+
+  if (area[0] != 'B' || area[1] != 'M') {
+    fprintf(stderr, "%s: no benchmark results found\n", argv[1]);
+    return 1;
+  }
+  if (area[2] != VERSION || area[4] != QUERIES) {
+    fprintf(stderr, "%s: benchmark version %d, %d queries not supported\n",
+            argv[1], area[2], area[4]);
+    return 1;
+  }
+  solver = area[3];
+  done = area[5];
+  queries = area[6] ? QUERIES : done;
+  frame = area[7] ? 29781 : 33248;
+  if (done > QUERIES) {
+    fprintf(stderr, "%s: bad benchmark header\n", argv[1]);
+    return 1;
+  }
+  if (!area[6]) {
+    fprintf(stderr, "%s: first pass not complete, %d of %d queries\n",
+            argv[1], done, QUERIES);
+  }
+
+  printf("query,solver,system,sx,sy,dx,dy,nodes,work,cycles,frames,cycles_per_work\n");
+  for (q = 0; q < queries; ++q) {
+    r = &area[HEADER + q * RECORD];
+    cycles = r[0] | (r[1] << 8) | ((unsigned long)r[2] << 16) |
+             ((unsigned long)r[3] << 24);
+    work = r[6] | (r[7] << 8);
+    total += cycles;
+    total_work += work;
+    printf("%d,", q);
+    if (solver < 6) printf("%s,", solver_name[solver]);
+    else printf("%d,", solver);
+    printf("%s,%d,%d,%d,%d,%d,%lu,%lu,%.2f,", area[7] ? "ntsc" : "pal",
+           script[q][0], script[q][1], script[q][2], script[q][3],
+           (short)(r[4] | (r[5] << 8)), work,
+           cycles, (double)cycles / frame);
+    if (work) printf("%.1f", (double)cycles / work);
+    printf("\n");
+  }
+  printf("total,,,,,,,,%lu,%lu,%.2f,", total_work, total, (double)total / frame);
+  if (total_work) printf("%.1f", (double)total / total_work);
+  printf("\n");
+  return 0;
+}
@@ -0,0 +1,170 @@
+/*
+============================================================
+Solver Context Check - Host Tool
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+
+Runs solver_run() on random grids and on area, with the area
+landmarks set, and checks every result against a breadth-first
+search: astar and idastar paths must be shortest, dfs and lrta
+paths must be walkable, and grid_solid and grid_map must be the
+caller's again after each run. Exits with 1 on any mismatch.
+Built from the solver sources, 4-connected:
+
+  cc -std=c99 -O2 -D__fastcall__= -I. -o ctxcheck tools/ctxcheck.c \
+    solver.c astar.c dfs.c idastar.c lrta.c swamp.c grid.c \
+    area.c landmark_data.c
+  ./ctxcheck
+*/
+#include "solver.h"
+#include "astar.h"
+#include "dfs.h"
+#include "idastar.h"
+#include "lrta.h"
+#include "landmarks.h"
+#include "area.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define GRIDS      8
+#define QUERIES    4000
+#define DENSITY    25           /* Percent of solid cells */
+#define IDA_RANGE  20           /* Longer idastar queries go to astar */
+
+static char map[GRIDS][GRID_SIZE_Y][GRID_SIZE_X];
+static uint8_t solid[GRIDS][GRID_BYTES];
+static uint8_t home[GRID_BYTES];
+static int dist[GRID_CELLS];
+static int queue[GRID_CELLS];
+static uint8_t path_x[GRID_CELLS], path_y[GRID_CELLS];
+
+static int is_open(int g, int x, int y) {
+  return x >= 0 && y >= 0 && x < GRID_SIZE_X && y < GRID_SIZE_Y &&
+    map[g][y][x] == ' ';
+}
+
+/* Steps from (sx, sy) to (dx, dy) on map g, -1 if unreachable */
+static int bfs(int g, int sx, int sy, int dx, int dy) {
+  int head = 0, tail = 0, c, d, x, y;
+  if (!is_open(g, sx, sy) || !is_open(g, dx, dy)) return -1;
+  memset(dist, -1, sizeof(dist));
+  dist[sy * GRID_SIZE_X + sx] = 0;
+  queue[tail++] = sy * GRID_SIZE_X + sx;
+  while (head < tail) {
+    c = queue[head++];
+    for (d = 0; d < 4; ++d) {
+      x = c % GRID_SIZE_X + grid_dx[d];
+      y = c / GRID_SIZE_X + grid_dy[d];
+      if (!is_open(g, x, y) || dist[y * GRID_SIZE_X + x] >= 0) continue;
+      dist[y * GRID_SIZE_X + x] = dist[c] + 1;
+      queue[tail++] = y * GRID_SIZE_X + x;
+    }
+  }
+  return dist[dy * GRID_SIZE_X + dx];
+}
+
+/* Path starts and ends right and only takes open, adjacent cells */
+static int walkable(int g, const SolverContext* ctx) {
+  const SolverPath* p = ctx->path;
+  int i;
+  if (p->x[0] != ctx->sx || p->y[0] != ctx->sy) return 0;
+  if (p->x[p->count - 1] != ctx->dx || p->y[p->count - 1] != ctx->dy) return 0;
+  for (i = 1; i < p->count; ++i) {
+    if (abs(p->x[i] - p->x[i - 1]) + abs(p->y[i] - p->y[i - 1]) != 1) return 0;
+    if (!is_open(g, p->x[i], p->y[i])) return 0;
+  }
+  return 1;
+}
+
+/* Map g: area for 0, random obstacles for the others */
+static void make_map(int g) {
+  int x, y;
+  for (y = 0; y < GRID_SIZE_Y; ++y) {
+    for (x = 0; x < GRID_SIZE_X; ++x) {
+      map[g][y][x] = g == 0 ? area[y][x] : rand() % 100 < DENSITY ? '#' : ' ';
+    }
+    grid_set_row(y, map[g][y]);
+  }
+  memcpy(solid[g], grid_solid, GRID_BYTES);
+}
+
+int main(void) {
+  SolverGrid grid = {NULL, GRID_SIZE_X, GRID_SIZE_Y};
+  SolverPath path = {path_x, path_y, GRID_CELLS, 0};
+  SolverContext ctx;
+  int g, k, b, ok, bad = 0, found = 0;
+  byte status;
+
+  srand(1);
+  for (g = 0; g < GRIDS; ++g) make_map(g);
+
+  initialize_astar_solver();
+  initialize_dfs_solver();
+  initialize_idastar_solver();
+  initialize_lrta_solver();
+  grid_load_area();
+  astar_set_landmarks(&landmark_dist[0][0], LANDMARK_COUNT);
+  memcpy(home, grid_solid, GRID_BYTES);
+
+  ctx.grid = &grid;
+  ctx.path = &path;
+  for (k = 0; k < QUERIES; ++k) {
+    /* Map 0 is searched in place, the others through the swap */
+    g = rand() % GRIDS;
+    grid.solid = g == 0 ? NULL : solid[g];
+    ctx.solver = rand() % 4;
+    ctx.sx = rand() % GRID_SIZE_X;
+    ctx.sy = rand() % GRID_SIZE_Y;
+    ctx.dx = rand() % GRID_SIZE_X;
+    ctx.dy = rand() % GRID_SIZE_Y;
+    if (ctx.solver == SOLVER_IDASTAR &&
+        abs(ctx.sx - ctx.dx) + abs(ctx.sy - ctx.dy) > IDA_RANGE) {
+      ctx.solver = SOLVER_ASTAR;
+    }
+
+    b = bfs(g, ctx.sx, ctx.sy, ctx.dx, ctx.dy);
+    status = solver_run(&ctx);
+    if (ctx.solver == SOLVER_LRTA && status == SOLVER_TOO_LONG) {
+      ok = 1;
+    } else if (b <= 0) {
+      ok = status == SOLVER_NO_PATH;
+    } else {
+      ok = status == SOLVER_FOUND && walkable(g, &ctx);
+      if (ctx.solver == SOLVER_ASTAR || ctx.solver == SOLVER_IDASTAR) {
+        ok = ok && path.count == b + 1;
+      }
+      ++found;
+    }
+    if (memcmp(grid_solid, home, GRID_BYTES) || grid_map != GRID_MAP_AREA) ok = 0;
+
+    if (!ok) {
+      if (bad < 10) {
+        fprintf(stderr, "solver %d, grid %d: %d,%d -> %d,%d: bfs %d, status %d, %d nodes\n",
+          ctx.solver, g, ctx.sx, ctx.sy, ctx.dx, ctx.dy, b, status, path.count);
+      }
+      ++bad;
+    }
+  }
+  printf("%d queries, %d paths, %d bad\n", QUERIES, found, bad);
+  return bad ? 1 : 0;
+}
@@ -0,0 +1,203 @@
+/*
+============================================================
+Landmark Tables - Host Tool
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+
+Picks landmark cells on a 32x30 map and writes the BFS distance
+from each of them to every cell, as landmark_data.c. Landmarks
+are picked greedily: each one is the open cell that most raises
+the heuristic (max of Manhattan and the landmarks so far) over a
+fixed sample of connected cell pairs.
+
+The map is either a text file (one row per line) or a C source
+like area.c, whose rows are the quoted strings.
+
+  cc -O2 -o landmarks tools/landmarks.c
+  ./landmarks area.c > landmark_data.c
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Grid size of grid.h, e.g. -DGRID_SIZE_X=16 -DGRID_SIZE_Y=15 */
+#ifndef GRID_SIZE_X
+#define GRID_SIZE_X 32
+#endif
+#ifndef GRID_SIZE_Y
+#define GRID_SIZE_Y 30
+#endif
+
+#define SIZE_X     GRID_SIZE_X
+#define SIZE_Y     GRID_SIZE_Y
+#define CELLS      (SIZE_X * SIZE_Y)
+#define MAX_COUNT  8
+#define FAR        255          /* Unreachable */
+#define NEAR_MAX   (FAR - 1)    /* Reachable distances are clamped here */
+#define UNSEEN     -1
+#define SAMPLES    4096
+
+static char map[SIZE_Y][SIZE_X + 1];
+static int dist[CELLS][CELLS];
+static int queue[CELLS];
+static int pair_a[SAMPLES], pair_b[SAMPLES], bound[SAMPLES];
+
+static int is_open(int c) {
+  return map[c / SIZE_X][c % SIZE_X] == ' ';
+}
+
+/* Clamps like the table, which keeps the bound consistent */
+static int clamp(int d) {
+  return d > NEAR_MAX ? NEAR_MAX : d;
+}
+
+/* Lower bound on d(a, b) given by landmark l, if any */
+static int landmark_bound(int l, int a, int b) {
+  int da = dist[l][a], db = dist[l][b];
+  if (da == UNSEEN || db == UNSEEN) return 0;
+  return abs(clamp(da) - clamp(db));
+}
+
+static void bfs(int from, int *d) {
+  static const int dx[4] = {1, -1, 0, 0};
+  static const int dy[4] = {0, 0, 1, -1};
+  int head = 0, tail = 0, c, k, x, y;
+
+  for (c = 0; c < CELLS; ++c) d[c] = UNSEEN;
+  d[from] = 0;
+  queue[tail++] = from;
+  while (head < tail) {
+    c = queue[head++];
+    for (k = 0; k < 4; ++k) {
+      x = c % SIZE_X + dx[k];
+      y = c / SIZE_X + dy[k];
+      if (x < 0 || y < 0 || x >= SIZE_X || y >= SIZE_Y) continue;
+      if (!is_open(y * SIZE_X + x) || d[y * SIZE_X + x] != UNSEEN) continue;
+      d[y * SIZE_X + x] = d[c] + 1;
+      queue[tail++] = y * SIZE_X + x;
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  FILE *f;
+  char line[256], *row, *end;
+  int count = 4, h = 0, n, c, l, a, b, d, best, gain, samples, is_source;
+  int pick[MAX_COUNT];
+
+  if (argc < 2 || argc > 3 || (argc == 3 && (count = atoi(argv[2])) < 1) || count > MAX_COUNT) {
+    fprintf(stderr, "usage: %s map [count, 1..%d] > landmark_data.c\n", argv[0], MAX_COUNT);
+    return 1;
+  }
+  f = fopen(argv[1], "r");
+  if (!f) {
+    perror(argv[1]);
+    return 1;
+  }
+  n = (int)strlen(argv[1]);
+  is_source = n > 2 && !strcmp(argv[1] + n - 2, ".c");
+  while (h < SIZE_Y && fgets(line, sizeof(line), f)) {
+    if (is_source) {
+      row = strchr(line, '"');
+      if (!row || !(end = strchr(++row, '"'))) continue;
+      *end = 0;
+    } else {
+      row = line;
+      row[strcspn(row, "\r\n")] = 0;
+      if (!*row) continue;
+    }
+    if ((int)strlen(row) != SIZE_X) {
+      fprintf(stderr, "%s: row %d is %d wide, expected %d\n", argv[1], h + 1, (int)strlen(row), SIZE_X);
+      return 1;
+    }
+    strcpy(map[h++], row);
+  }
+  fclose(f);
+  if (h != SIZE_Y) {
+    fprintf(stderr, "%s: %d rows, expected %d\n", argv[1], h, SIZE_Y);
+    return 1;
+  }
+
+  for (c = 0; c < CELLS; ++c) {
+    if (is_open(c)) bfs(c, dist[c]);
+  }
+
+  /* Sample connected pairs (fixed seed, same tables every run) */
+  srand(1);
+  for (n = 0, l = 0; n < SAMPLES && l < SAMPLES * 64; ++l) {
+    a = rand() % CELLS;
+    b = rand() % CELLS;
+    if (a == b || !is_open(a) || !is_open(b) || dist[a][b] == UNSEEN) continue;
+    pair_a[n] = a;
+    pair_b[n] = b;
+    bound[n] = abs(a % SIZE_X - b % SIZE_X) + abs(a / SIZE_X - b / SIZE_X);
+    ++n;
+  }
+  samples = n;
+  if (!samples) {
+    fprintf(stderr, "%s: no connected cells\n", argv[1]);
+    return 1;
+  }
+
+  for (n = 0; n < count; ++n) {
+    best = -1;
+    for (c = 0; c < CELLS; ++c) {
+      if (!is_open(c)) continue;
+      for (gain = 0, l = 0; l < samples; ++l) {
+        d = landmark_bound(c, pair_a[l], pair_b[l]);
+        if (d > bound[l]) gain += d - bound[l];
+      }
+      if (gain > best) {
+        best = gain;
+        pick[n] = c;
+      }
+    }
+    for (l = 0; l < samples; ++l) {
+      d = landmark_bound(pick[n], pair_a[l], pair_b[l]);
+      if (d > bound[l]) bound[l] = d;
+    }
+  }
+
+  printf("/* Generated by tools/landmarks.c from %s -- do not edit */\n", argv[1]);
+  printf("#include \"landmarks.h\"\n\n");
+  printf("#if LANDMARK_COUNT != %d\n", count);
+  printf("#error \"landmarks.h does not match the number of landmarks\"\n");
+  printf("#endif\n\n");
+  printf("const uint8_t landmark_x[LANDMARK_COUNT] = {");
+  for (l = 0; l < count; ++l) printf(" %d,", pick[l] % SIZE_X);
+  printf(" };\n");
+  printf("const uint8_t landmark_y[LANDMARK_COUNT] = {");
+  for (l = 0; l < count; ++l) printf(" %d,", pick[l] / SIZE_X);
+  printf(" };\n\n");
+  printf("const uint8_t landmark_dist[LANDMARK_COUNT][LANDMARK_CELLS] = {\n");
+  for (l = 0; l < count; ++l) {
+    printf("  {");
+    for (c = 0; c < CELLS; ++c) {
+      d = dist[pick[l]][c];
+      d = d == UNSEEN ? FAR : clamp(d);
+      printf("%s%d,", (c % SIZE_X) ? "" : "\n    ", d);
+    }
+    printf("\n  },\n");
+  }
+  printf("};\n");
+  return 0;
+}
@@ -0,0 +1,305 @@
+/*
+============================================================
+Benchmark Map Generator - Host Tool
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+
+Generates 32x30 benchmark maps as area-format C sources (a drop-in
+for area.c) with a benchmark script of BENCH_QUERIES queries over
+the map, from adjacent cells to the longest paths found, plus an
+unreachable one when the map has walled-in cells. The output only
+depends on the arguments, so the same map comes out everywhere.
+
+  maze    [loops%]    depth-first maze, loops% of walls knocked out
+  rooms   [min size]  recursive division into rooms joined by doors
+  random  [density%]  scattered single-cell obstacles
+  spiral  [width]     nested square rings, gaps on alternate sides
+
+  cc -O2 -o mapgen tools/mapgen.c
+  ./mapgen maze 10 1 > maps/corpus/maze_loops.c
+
+maps/corpus holds a reference set made with it (see README.md).
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Grid size of grid.h, e.g. -DGRID_SIZE_X=16 -DGRID_SIZE_Y=15 */
+#ifndef GRID_SIZE_X
+#define GRID_SIZE_X 32
+#endif
+#ifndef GRID_SIZE_Y
+#define GRID_SIZE_Y 30
+#endif
+
+#define SIZE_X     GRID_SIZE_X
+#define SIZE_Y     GRID_SIZE_Y
+#define CELLS      (SIZE_X * SIZE_Y)
+#define QUERIES    7     /* BENCH_QUERIES */
+#define SAMPLES    2048
+#define UNSEEN     -1
+#define SOLID      'X'
+#define OPEN       ' '
+
+static char map[SIZE_Y][SIZE_X + 1];
+static int dist[CELLS];
+static int queue[CELLS];
+static int pair_a[SAMPLES], pair_b[SAMPLES], pair_d[SAMPLES];
+static unsigned long seed;
+
+/* Portable generator (xorshift32), unlike rand() */
+static int next_random(int n) {
+  seed ^= (seed << 13) & 0xFFFFFFFFUL;
+  seed ^= seed >> 17;
+  seed ^= (seed << 5) & 0xFFFFFFFFUL;
+  return (int)(seed % (unsigned long)n);
+}
+
+static void fill(int x0, int y0, int x1, int y1, char c) {
+  int x, y;
+  for (y = y0; y <= y1; ++y) {
+    for (x = x0; x <= x1; ++x) map[y][x] = c;
+  }
+}
+
+/* Outer wall, like area.c */
+static void border(void) {
+  fill(0, 0, SIZE_X - 1, 0, SOLID);
+  fill(0, SIZE_Y - 1, SIZE_X - 1, SIZE_Y - 1, SOLID);
+  fill(0, 0, 0, SIZE_Y - 1, SOLID);
+  fill(SIZE_X - 1, 0, SIZE_X - 1, SIZE_Y - 1, SOLID);
+}
+
+/* Maze cells on odd coordinates, carved depth-first */
+static void make_maze(int loops) {
+  static const int dx[4] = {2, -2, 0, 0};
+  static const int dy[4] = {0, 0, 2, -2};
+  int top = 0, c, k, n, x, y, nx, ny, dirs[4];
+
+  fill(0, 0, SIZE_X - 1, SIZE_Y - 1, SOLID);
+  map[1][1] = OPEN;
+  queue[top++] = 1 * SIZE_X + 1;
+  while (top) {
+    c = queue[top - 1];
+    x = c % SIZE_X;
+    y = c / SIZE_X;
+    for (n = 0, k = 0; k < 4; ++k) {
+      nx = x + dx[k];
+      ny = y + dy[k];
+      if (nx < 1 || ny < 1 || nx > SIZE_X - 2 || ny > SIZE_Y - 2) continue;
+      if (map[ny][nx] == SOLID) dirs[n++] = k;
+    }
+    if (!n) {
+      --top;
+      continue;
+    }
+    k = dirs[next_random(n)];
+    map[y + dy[k] / 2][x + dx[k] / 2] = OPEN;
+    map[y + dy[k]][x + dx[k]] = OPEN;
+    queue[top++] = (y + dy[k]) * SIZE_X + x + dx[k];
+  }
+
+  /* Knock out walls between two corridors */
+  for (y = 1; y < SIZE_Y - 1; ++y) {
+    for (x = 1; x < SIZE_X - 1; ++x) {
+      if (map[y][x] != SOLID || next_random(100) >= loops) continue;
+      if ((map[y][x - 1] == OPEN && map[y][x + 1] == OPEN &&
+           map[y - 1][x] == SOLID && map[y + 1][x] == SOLID) ||
+          (map[y - 1][x] == OPEN && map[y + 1][x] == OPEN &&
+           map[y][x - 1] == SOLID && map[y][x + 1] == SOLID)) {
+        map[y][x] = OPEN;
+      }
+    }
+  }
+}
+
+/* Splits the open box (x0, y0)-(x1, y1) with a wall and a door */
+static void divide(int x0, int y0, int x1, int y1, int min) {
+  int w = x1 - x0 + 1, h = y1 - y0 + 1, at, door;
+
+  if (w < 2 * min + 1 && h < 2 * min + 1) return;
+  if (w > h || (w == h && next_random(2))) {
+    if (w < 2 * min + 1) return;
+    at = x0 + min + next_random(w - 2 * min);
+    door = y0 + next_random(h);
+    fill(at, y0, at, y1, SOLID);
+    map[door][at] = OPEN;
+    divide(x0, y0, at - 1, y1, min);
+    divide(at + 1, y0, x1, y1, min);
+  } else {
+    if (h < 2 * min + 1) return;
+    at = y0 + min + next_random(h - 2 * min);
+    door = x0 + next_random(w);
+    fill(x0, at, x1, at, SOLID);
+    map[at][door] = OPEN;
+    divide(x0, y0, x1, at - 1, min);
+    divide(x0, at + 1, x1, y1, min);
+  }
+}
+
+static void make_rooms(int min) {
+  fill(0, 0, SIZE_X - 1, SIZE_Y - 1, OPEN);
+  border();
+  divide(1, 1, SIZE_X - 2, SIZE_Y - 2, min < 1 ? 1 : min);
+}
+
+static void make_random(int density) {
+  int x, y;
+  fill(0, 0, SIZE_X - 1, SIZE_Y - 1, OPEN);
+  border();
+  for (y = 1; y < SIZE_Y - 1; ++y) {
+    for (x = 1; x < SIZE_X - 1; ++x) {
+      if (next_random(100) < density) map[y][x] = SOLID;
+    }
+  }
+}
+
+/* Rings of walls width cells apart, each one with a gap that
+   alternates sides, so the only way in winds round every ring */
+static void make_spiral(int width) {
+  int ring, x0, y0, x1, y1, step;
+
+  if (width < 1) width = 1;
+  step = width + 1;
+  fill(0, 0, SIZE_X - 1, SIZE_Y - 1, OPEN);
+  border();
+  for (ring = 1; ; ++ring) {
+    x0 = ring * step;
+    y0 = ring * step;
+    x1 = SIZE_X - 1 - ring * step;
+    y1 = SIZE_Y - 1 - ring * step;
+    if (x1 - x0 < 2 || y1 - y0 < 2) break;
+    fill(x0, y0, x1, y0, SOLID);
+    fill(x0, y1, x1, y1, SOLID);
+    fill(x0, y0, x0, y1, SOLID);
+    fill(x1, y0, x1, y1, SOLID);
+    if (ring & 1) fill(x0 + 1, y0, x0 + width, y0, OPEN);
+    else fill(x1 - width, y1, x1 - 1, y1, OPEN);
+  }
+}
+
+static void bfs(int from) {
+  static const int dx[4] = {1, -1, 0, 0};
+  static const int dy[4] = {0, 0, 1, -1};
+  int head = 0, tail = 0, c, k, x, y;
+
+  for (c = 0; c < CELLS; ++c) dist[c] = UNSEEN;
+  dist[from] = 0;
+  queue[tail++] = from;
+  while (head < tail) {
+    c = queue[head++];
+    for (k = 0; k < 4; ++k) {
+      x = c % SIZE_X + dx[k];
+      y = c / SIZE_X + dy[k];
+      if (x < 0 || y < 0 || x >= SIZE_X || y >= SIZE_Y) continue;
+      if (map[y][x] != OPEN || dist[y * SIZE_X + x] != UNSEEN) continue;
+      dist[y * SIZE_X + x] = dist[c] + 1;
+      queue[tail++] = y * SIZE_X + x;
+    }
+  }
+}
+
+static int by_distance(const void *a, const void *b) {
+  return pair_d[*(const int *)a] - pair_d[*(const int *)b];
+}
+
+/*
+  Random open cell pairs, spread evenly from the shortest path to
+  the longest; the last query is unreachable if any pair was.
+*/
+static void print_script(void) {
+  static int order[SAMPLES];
+  int open[CELLS], opens = 0, c, n, reachable = 0, unreachable = -1, q, count;
+
+  for (c = 0; c < CELLS; ++c) {
+    if (map[c / SIZE_X][c % SIZE_X] == OPEN) open[opens++] = c;
+  }
+  for (n = 0; opens > 1 && n < SAMPLES; ++n) {
+    pair_a[n] = open[next_random(opens)];
+    do pair_b[n] = open[next_random(opens)]; while (pair_b[n] == pair_a[n]);
+    bfs(pair_a[n]);
+    pair_d[n] = dist[pair_b[n]];
+    if (pair_d[n] == UNSEEN) {
+      if (unreachable < 0) unreachable = n;
+    } else {
+      order[reachable++] = n;
+    }
+  }
+  qsort(order, (size_t)reachable, sizeof(order[0]), by_distance);
+
+  /* After the rows: tools/landmarks.c and tools/pathdb.c read
+     the first GRID_SIZE_Y quoted strings */
+  printf("#include \"bench.h\"\n\n");
+  printf("#ifdef BENCH_AREA_SCRIPT\n");
+  printf("const BenchQuery bench_script[BENCH_QUERIES] = {\n");
+  count = unreachable >= 0 ? QUERIES - 1 : QUERIES;
+  for (q = 0; q < count && reachable; ++q) {
+    n = order[count > 1 ? q * (reachable - 1) / (count - 1) : 0];
+    printf("  {%2d, %2d, %2d, %2d},   /* %d step%s */\n",
+           pair_a[n] % SIZE_X, pair_a[n] / SIZE_X,
+           pair_b[n] % SIZE_X, pair_b[n] / SIZE_X,
+           pair_d[n], pair_d[n] == 1 ? "" : "s");
+  }
+  if (unreachable >= 0) {
+    n = unreachable;
+    printf("  {%2d, %2d, %2d, %2d},   /* Unreachable */\n",
+           pair_a[n] % SIZE_X, pair_a[n] / SIZE_X,
+           pair_b[n] % SIZE_X, pair_b[n] / SIZE_X);
+  }
+  printf("};\n#endif\n");
+}
+
+static const struct {
+  const char *name;
+  void (*make)(int param);
+  int param;
+} kinds[] = {
+  {"maze",   make_maze,   0},
+  {"rooms",  make_rooms,  4},
+  {"random", make_random, 20},
+  {"spiral", make_spiral, 1},
+};
+
+int main(int argc, char **argv) {
+  int k, param, y;
+  unsigned long first_seed;
+
+  for (k = 0; k < 4 && (argc < 2 || strcmp(argv[1], kinds[k].name)); ++k);
+  if (k == 4) {
+    fprintf(stderr, "usage: %s maze|rooms|random|spiral [param] [seed] > map.c\n", argv[0]);
+    return 1;
+  }
+  param = argc > 2 ? atoi(argv[2]) : kinds[k].param;
+  first_seed = argc > 3 ? strtoul(argv[3], NULL, 10) : 1;
+  seed = first_seed ? first_seed : 1;
+  kinds[k].make(param);
+
+  printf("/* Generated by tools/mapgen.c: %s %d, seed %lu -- do not edit */\n",
+         kinds[k].name, param, first_seed);
+  printf("const char area[%d][%d] = {\n", SIZE_Y, SIZE_X);
+  for (y = 0; y < SIZE_Y; ++y) {
+    printf("  {\"%.*s\"}%s\n", SIZE_X, map[y], y < SIZE_Y - 1 ? "," : "");
+  }
+  printf("};\n\n");
+  print_script();
+  return 0;
+}
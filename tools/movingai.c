@@ -0,0 +1,220 @@
+/*
+============================================================
+Moving AI Map Importer - Host Tool
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+
+Converts a map from the Moving AI benchmark sets (.map, with an
+optional .scen) into an area-format C source like the ones from
+tools/mapgen.c. A 32x30 window of the map is taken from (x, y),
+each cell covering scale x scale map cells: it is open only if all
+of them are passable ('.', 'G' or 'S'), so scaling never opens a
+way that the map does not have. Cells beyond the map are solid.
+
+The benchmark script takes BENCH_QUERIES scenario problems whose
+ends both land on open cells, spread evenly over their optimal
+lengths. Moving AI lengths are 8-connected, the comments give the
+4-connected BFS distance on the converted grid as well.
+
+  cc -O2 -o movingai tools/movingai.c
+  ./movingai -x 100 -y 40 -s 2 den011d.map den011d.map.scen > map.c
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Grid size of grid.h, e.g. -DGRID_SIZE_X=16 -DGRID_SIZE_Y=15 */
+#ifndef GRID_SIZE_X
+#define GRID_SIZE_X 32
+#endif
+#ifndef GRID_SIZE_Y
+#define GRID_SIZE_Y 30
+#endif
+
+#define SIZE_X     GRID_SIZE_X
+#define SIZE_Y     GRID_SIZE_Y
+#define CELLS      (SIZE_X * SIZE_Y)
+#define QUERIES    7     /* BENCH_QUERIES */
+#define MAX_SIDE   4096
+#define MAX_SCEN   8192
+#define UNSEEN     -1
+#define SOLID      'X'
+#define OPEN       ' '
+
+typedef struct Problem {
+  int a, b;
+  double optimal;
+} Problem;
+
+static char map[SIZE_Y][SIZE_X + 1];
+static char row[MAX_SIDE + 2];
+static int dist[CELLS];
+static int queue[CELLS];
+static Problem problem[MAX_SCEN];
+
+static int passable(char c) {
+  return c == '.' || c == 'G' || c == 'S';
+}
+
+static void bfs(int from) {
+  static const int dx[4] = {1, -1, 0, 0};
+  static const int dy[4] = {0, 0, 1, -1};
+  int head = 0, tail = 0, c, k, x, y;
+
+  for (c = 0; c < CELLS; ++c) dist[c] = UNSEEN;
+  dist[from] = 0;
+  queue[tail++] = from;
+  while (head < tail) {
+    c = queue[head++];
+    for (k = 0; k < 4; ++k) {
+      x = c % SIZE_X + dx[k];
+      y = c / SIZE_X + dy[k];
+      if (x < 0 || y < 0 || x >= SIZE_X || y >= SIZE_Y) continue;
+      if (map[y][x] != OPEN || dist[y * SIZE_X + x] != UNSEEN) continue;
+      dist[y * SIZE_X + x] = dist[c] + 1;
+      queue[tail++] = y * SIZE_X + x;
+    }
+  }
+}
+
+static int by_optimal(const void *a, const void *b) {
+  double d = ((const Problem *)a)->optimal - ((const Problem *)b)->optimal;
+  return d < 0 ? -1 : d > 0;
+}
+
+/* Grid cell of map cell (mx, my), or -1 if off the window or solid */
+static int grid_cell(int mx, int my, int ox, int oy, int scale) {
+  int x, y;
+  if (mx < ox || my < oy) return -1;
+  x = (mx - ox) / scale;
+  y = (my - oy) / scale;
+  if (x >= SIZE_X || y >= SIZE_Y || map[y][x] != OPEN) return -1;
+  return y * SIZE_X + x;
+}
+
+int main(int argc, char **argv) {
+  FILE *f;
+  char name[256];
+  int ox = 0, oy = 0, scale = 1, arg = 1, w = 0, h = 0;
+  int x, y, mx, my, len, n = 0, q, bucket, mw, mh, sx, sy, gx, gy;
+  double optimal;
+  Problem *p;
+
+  for (; arg + 1 < argc && argv[arg][0] == '-'; arg += 2) {
+    if (!strcmp(argv[arg], "-x")) ox = atoi(argv[arg + 1]);
+    else if (!strcmp(argv[arg], "-y")) oy = atoi(argv[arg + 1]);
+    else if (!strcmp(argv[arg], "-s")) scale = atoi(argv[arg + 1]);
+    else break;
+  }
+  if (arg >= argc || arg + 2 < argc || ox < 0 || oy < 0 || scale < 1) {
+    fprintf(stderr, "usage: %s [-x X] [-y Y] [-s scale] map.map [map.scen] > map.c\n", argv[0]);
+    return 1;
+  }
+
+  /* Header: type, height, width, then "map" */
+  f = fopen(argv[arg], "r");
+  if (!f) {
+    perror(argv[arg]);
+    return 1;
+  }
+  while (fgets(row, sizeof(row), f) && strncmp(row, "map", 3)) {
+    sscanf(row, "height %d", &h);
+    sscanf(row, "width %d", &w);
+  }
+  if (w < 1 || h < 1 || w > MAX_SIDE || h > MAX_SIDE) {
+    fprintf(stderr, "%s: not a Moving AI map\n", argv[arg]);
+    return 1;
+  }
+
+  /* Cells start open, any solid map cell under them closes them */
+  for (y = 0; y < SIZE_Y; ++y) {
+    memset(map[y], OPEN, SIZE_X);
+    map[y][SIZE_X] = 0;
+  }
+  for (my = 0; my < h && fgets(row, sizeof(row), f); ++my) {
+    len = (int)strcspn(row, "\r\n");
+    for (y = 0; y < SIZE_Y; ++y) {
+      for (x = 0; x < SIZE_X; ++x) {
+        if (my < oy + y * scale || my >= oy + (y + 1) * scale) continue;
+        for (mx = ox + x * scale; mx < ox + (x + 1) * scale; ++mx) {
+          if (mx >= len || mx >= w || !passable(row[mx])) map[y][x] = SOLID;
+        }
+      }
+    }
+  }
+  fclose(f);
+  for (y = 0; y < SIZE_Y; ++y) {
+    for (x = 0; x < SIZE_X; ++x) {
+      if (oy + (y + 1) * scale > my) map[y][x] = SOLID;
+    }
+  }
+
+  printf("/* Generated by tools/movingai.c from %s (x %d, y %d, scale %d) -- do not edit */\n",
+         argv[arg], ox, oy, scale);
+  printf("const char area[%d][%d] = {\n", SIZE_Y, SIZE_X);
+  for (y = 0; y < SIZE_Y; ++y) {
+    printf("  {\"%.*s\"}%s\n", SIZE_X, map[y], y < SIZE_Y - 1 ? "," : "");
+  }
+  printf("};\n");
+  if (arg + 1 >= argc) return 0;
+
+  /* Scenario: version line, then one problem per line */
+  f = fopen(argv[arg + 1], "r");
+  if (!f) {
+    perror(argv[arg + 1]);
+    return 1;
+  }
+  while (n < MAX_SCEN && fgets(row, sizeof(row), f)) {
+    if (sscanf(row, "%d %255s %d %d %d %d %d %d %lf",
+               &bucket, name, &mw, &mh, &sx, &sy, &gx, &gy, &optimal) != 9) continue;
+    p = &problem[n];
+    p->a = grid_cell(sx, sy, ox, oy, scale);
+    p->b = grid_cell(gx, gy, ox, oy, scale);
+    p->optimal = optimal;
+    if (p->a >= 0 && p->b >= 0 && p->a != p->b) ++n;
+  }
+  fclose(f);
+  qsort(problem, (size_t)n, sizeof(problem[0]), by_optimal);
+  if (n < QUERIES) {
+    fprintf(stderr, "%s: %d problem(s) in the window, %d wanted\n", argv[arg + 1], n, QUERIES);
+  }
+
+  /* After the rows: tools/landmarks.c and tools/pathdb.c read
+     the first GRID_SIZE_Y quoted strings */
+  printf("\n#include \"bench.h\"\n\n");
+  printf("#ifdef BENCH_AREA_SCRIPT\n");
+  printf("const BenchQuery bench_script[BENCH_QUERIES] = {\n");
+  for (q = 0; q < QUERIES; ++q) {
+    if (q >= n) {
+      printf("  { 0,  0,  0,  0},   /* Unused */\n");
+      continue;
+    }
+    p = &problem[n > QUERIES ? q * (n - 1) / (QUERIES - 1) : q];
+    bfs(p->a);
+    printf("  {%2d, %2d, %2d, %2d},   /* Optimal %.2f, ",
+           p->a % SIZE_X, p->a / SIZE_X, p->b % SIZE_X, p->b / SIZE_X, p->optimal);
+    if (dist[p->b] == UNSEEN) printf("unreachable here */\n");
+    else printf("%d step%s here */\n", dist[p->b], dist[p->b] == 1 ? "" : "s");
+  }
+  printf("};\n#endif\n");
+  return 0;
+}
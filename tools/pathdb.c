@@ -0,0 +1,255 @@
+/*
+============================================================
+Path Database Builder - Host Tool
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+
+Builds a compressed path database for a 32x30 map, written as
+pathdb_data.c: for every open cell, the first move of a shortest
+path from it to every other cell. Cells are numbered in depth-first
+order, so that nearby cells, and whole regions behind a door, get
+consecutive numbers and share their first move. Each row is then
+run-length encoded, picking among equally short moves the one that
+makes the current run longest; cells that cannot be reached (walls,
+other components) extend whichever run is open.
+
+The map is either a text file (one row per line) or a C source
+like area.c, whose rows are the quoted strings.
+
+  cc -O2 -o pathdb tools/pathdb.c
+  ./pathdb area.c > pathdb_data.c
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Grid size of grid.h, e.g. -DGRID_SIZE_X=16 -DGRID_SIZE_Y=15 */
+#ifndef GRID_SIZE_X
+#define GRID_SIZE_X 32
+#endif
+#ifndef GRID_SIZE_Y
+#define GRID_SIZE_Y 30
+#endif
+
+#define SIZE_X     GRID_SIZE_X
+#define SIZE_Y     GRID_SIZE_Y
+#define CELLS      (SIZE_X * SIZE_Y)
+#define UNSEEN     -1
+#define SOLID      0xFFFF
+#define ANY_MOVE   0x0F
+#define BANK_SIZE  8192
+
+/* Moves: right, left, down, up (same as the solvers) */
+static const int dx[4] = {1, -1, 0, 0};
+static const int dy[4] = {0, 0, 1, -1};
+
+static char map[SIZE_Y][SIZE_X + 1];
+static int dist[CELLS][CELLS];
+static int queue[CELLS];
+static int order[CELLS];       /* cell -> position, or SOLID   */
+static int cell_at[CELLS];     /* position -> cell             */
+static int component_end[CELLS];
+static unsigned char moves[CELLS];
+static unsigned run[CELLS];
+static unsigned bank_end[CELLS];    /* position after the last row of each bank */
+
+static int is_open(int c) {
+  return map[c / SIZE_X][c % SIZE_X] == ' ';
+}
+
+/* Neighbor of c in direction k, or -1 */
+static int neighbor(int c, int k) {
+  int x = c % SIZE_X + dx[k], y = c / SIZE_X + dy[k];
+  if (x < 0 || y < 0 || x >= SIZE_X || y >= SIZE_Y) return -1;
+  if (!is_open(y * SIZE_X + x)) return -1;
+  return y * SIZE_X + x;
+}
+
+static void bfs(int from, int *d) {
+  int head = 0, tail = 0, c, k, n;
+
+  for (c = 0; c < CELLS; ++c) d[c] = UNSEEN;
+  d[from] = 0;
+  queue[tail++] = from;
+  while (head < tail) {
+    c = queue[head++];
+    for (k = 0; k < 4; ++k) {
+      n = neighbor(c, k);
+      if (n < 0 || d[n] != UNSEEN) continue;
+      d[n] = d[c] + 1;
+      queue[tail++] = n;
+    }
+  }
+}
+
+/* Numbers the open cells in depth-first order, one component after the other */
+static int number_cells(int *components) {
+  int count = 0, top, c, k, n, s;
+
+  for (c = 0; c < CELLS; ++c) order[c] = SOLID;
+  *components = 0;
+  for (s = 0; s < CELLS; ++s) {
+    if (!is_open(s) || order[s] != SOLID) continue;
+    top = 0;
+    queue[top++] = s;
+    while (top) {
+      c = queue[--top];
+      if (order[c] != SOLID) continue;
+      cell_at[count] = c;
+      order[c] = count++;
+      /* Pushed in reverse, so that right is visited first */
+      for (k = 3; k >= 0; --k) {
+        n = neighbor(c, k);
+        if (n >= 0 && order[n] == SOLID) queue[top++] = n;
+      }
+    }
+    component_end[(*components)++] = count;
+  }
+  return count;
+}
+
+/* Run-length encodes the first moves from s, returns the run count */
+static int encode_row(int s, int count) {
+  int p, t, k, n, len, best, best_len, runs = 0;
+
+  for (p = 0; p < count; ++p) {
+    t = cell_at[p];
+    moves[p] = ANY_MOVE;
+    if (t == s || dist[s][t] == UNSEEN) continue;
+    moves[p] = 0;
+    for (k = 0; k < 4; ++k) {
+      n = neighbor(s, k);
+      if (n >= 0 && dist[n][t] == dist[s][t] - 1) moves[p] |= 1 << k;
+    }
+  }
+  for (p = 0; p < count; p += best_len) {
+    best = 0;
+    best_len = 0;
+    for (k = 0; k < 4; ++k) {
+      for (len = 0; p + len < count && (moves[p + len] >> k & 1); ++len);
+      if (len > best_len) {
+        best = k;
+        best_len = len;
+      }
+    }
+    run[runs++] = ((unsigned)p << 2) | (unsigned)best;
+  }
+  return runs;
+}
+
+int main(int argc, char **argv) {
+  FILE *f;
+  char line[256], *row, *end;
+  int h = 0, n, c, p, r, runs, count, components, is_source;
+  int bank = 0, used = 0, total = 0;
+
+  if (argc != 2) {
+    fprintf(stderr, "usage: %s map > pathdb_data.c\n", argv[0]);
+    return 1;
+  }
+  f = fopen(argv[1], "r");
+  if (!f) {
+    perror(argv[1]);
+    return 1;
+  }
+  n = (int)strlen(argv[1]);
+  is_source = n > 2 && !strcmp(argv[1] + n - 2, ".c");
+  while (h < SIZE_Y && fgets(line, sizeof(line), f)) {
+    if (is_source) {
+      row = strchr(line, '"');
+      if (!row || !(end = strchr(++row, '"'))) continue;
+      *end = 0;
+    } else {
+      row = line;
+      row[strcspn(row, "\r\n")] = 0;
+      if (!*row) continue;
+    }
+    if ((int)strlen(row) != SIZE_X) {
+      fprintf(stderr, "%s: row %d is %d wide, expected %d\n", argv[1], h + 1, (int)strlen(row), SIZE_X);
+      return 1;
+    }
+    strcpy(map[h++], row);
+  }
+  fclose(f);
+  if (h != SIZE_Y) {
+    fprintf(stderr, "%s: %d rows, expected %d\n", argv[1], h, SIZE_Y);
+    return 1;
+  }
+
+  count = number_cells(&components);
+  if (!count) {
+    fprintf(stderr, "%s: no open cells\n", argv[1]);
+    return 1;
+  }
+  for (c = 0; c < CELLS; ++c) {
+    if (is_open(c)) bfs(c, dist[c]);
+  }
+
+  printf("/* Generated by tools/pathdb.c from %s -- do not edit */\n", argv[1]);
+  printf("#include \"pathdb.h\"\n\n");
+  printf("#ifdef PATHDB_MMC3\n#pragma rodata-name (push, \"PATHDB0\")\n#endif\n\n");
+
+  /* Rows in position order, none straddling a bank */
+  for (p = 0; p < count; ++p) {
+    runs = encode_row(cell_at[p], count);
+    n = (runs + 1) * 2;
+    if (used + n > BANK_SIZE) {
+      bank_end[bank++] = (unsigned)p;
+      used = 0;
+      printf("#ifdef PATHDB_MMC3\n#pragma rodata-name (pop)\n");
+      printf("#pragma rodata-name (push, \"PATHDB%d\")\n#endif\n\n", bank);
+    }
+    used += n;
+    total += n;
+
+    printf("static const word row%d[%d] = {\n  %d,", p, runs + 1, runs);
+    for (r = 0; r < runs; ++r) {
+      printf("%s%u,", ((r + 1) % 12) ? "" : "\n  ", run[r]);
+    }
+    printf("\n};\n\n");
+  }
+  bank_end[bank++] = (unsigned)count;
+  printf("#ifdef PATHDB_MMC3\n#pragma rodata-name (pop)\n#endif\n\n");
+
+  printf("const word pathdb_order[PATHDB_CELLS] = {");
+  for (c = 0; c < CELLS; ++c) {
+    printf("%s%u,", (c % SIZE_X) ? "" : "\n  ", (unsigned)order[c]);
+  }
+  printf("\n};\n\n");
+  printf("const word pathdb_component_end[%d] = {", components);
+  for (c = 0; c < components; ++c) {
+    printf("%s%d,", (c % 12) ? "" : "\n  ", component_end[c]);
+  }
+  printf("\n};\n\n");
+  printf("const word* const pathdb_row[%d] = {", count);
+  for (p = 0; p < count; ++p) {
+    printf("%srow%d,", (p % 8) ? " " : "\n  ", p);
+  }
+  printf("\n};\n\n");
+  printf("const word pathdb_bank_end[%d] = {", bank);
+  for (r = 0; r < bank; ++r) printf(" %u,", bank_end[r]);
+  printf(" };\n");
+
+  fprintf(stderr, "%d cells, %d components, %d bytes of rows in %d banks\n",
+          count, components, total, bank);
+  return 0;
+}
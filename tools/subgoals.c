@@ -0,0 +1,209 @@
+/*
+============================================================
+Subgoal Graph Builder - Host Tool
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+
+Finds the subgoals of a 32x30 map and the pairs of them that
+solve_subgoal() may travel between in a straight Manhattan run,
+as subgoal_data.c (see subgoal.h).
+
+A subgoal is an open cell diagonal to a solid one, with both cells
+between them open: the convex corners that shortest paths turn
+around. Two cells are h-reachable if a path as long as their
+Manhattan distance joins them. Subgoals a and b get an edge when
+they are h-reachable and no other subgoal c splits the run, being
+h-reachable from both with d(a, c) + d(c, b) = d(a, b): a path
+through a and b can go through c instead.
+
+The map is either a text file (one row per line) or a C source
+like area.c, whose rows are the quoted strings.
+
+  cc -O2 -o subgoals tools/subgoals.c
+  ./subgoals area.c > subgoal_data.c
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Grid size of grid.h, e.g. -DGRID_SIZE_X=16 -DGRID_SIZE_Y=15 */
+#ifndef GRID_SIZE_X
+#define GRID_SIZE_X 32
+#endif
+#ifndef GRID_SIZE_Y
+#define GRID_SIZE_Y 30
+#endif
+
+#define SIZE_X     GRID_SIZE_X
+#define SIZE_Y     GRID_SIZE_Y
+#define CELLS      (SIZE_X * SIZE_Y)
+#define MAX_NODES  250   /* SUBGOAL_MAX */
+
+static char map[SIZE_Y][SIZE_X + 1];
+static int node_x[MAX_NODES], node_y[MAX_NODES];
+static unsigned char reach[MAX_NODES][CELLS / 8];
+static unsigned char box[SIZE_Y][SIZE_X];
+static int edges_of[MAX_NODES][MAX_NODES];
+static int edge_count[MAX_NODES];
+
+static int is_open(int x, int y) {
+  return x >= 0 && y >= 0 && x < SIZE_X && y < SIZE_Y && map[y][x] == ' ';
+}
+
+/* Open, with a solid diagonal neighbor and both cells between open */
+static int is_subgoal(int x, int y) {
+  int dx, dy;
+
+  if (!is_open(x, y)) return 0;
+  for (dy = -1; dy <= 1; dy += 2) {
+    for (dx = -1; dx <= 1; dx += 2) {
+      if (x + dx < 0 || y + dy < 0 || x + dx >= SIZE_X || y + dy >= SIZE_Y) continue;
+      if (!is_open(x + dx, y + dy) && is_open(x + dx, y) && is_open(x, y + dy)) return 1;
+    }
+  }
+  return 0;
+}
+
+/* Every cell joined to (x0, y0) by a path of Manhattan length */
+static void h_reach(int x0, int y0, unsigned char *bits) {
+  int qx, qy, x, y;
+
+  memset(bits, 0, CELLS / 8);
+  memset(box, 0, sizeof(box));
+  for (qx = -1; qx <= 1; qx += 2) {
+    for (qy = -1; qy <= 1; qy += 2) {
+      for (y = y0; y >= 0 && y < SIZE_Y; y += qy) {
+        for (x = x0; x >= 0 && x < SIZE_X; x += qx) {
+          if (!is_open(x, y)) continue;
+          if ((x == x0 && y == y0) ||
+              (x != x0 && box[y][x - qx]) ||
+              (y != y0 && box[y - qy][x])) {
+            box[y][x] = 1;
+            bits[(y * SIZE_X + x) / 8] |= 1 << (x % 8);
+          }
+        }
+      }
+    }
+  }
+}
+
+static int reaches(int a, int b) {
+  return reach[a][(node_y[b] * SIZE_X + node_x[b]) / 8] & (1 << (node_x[b] % 8));
+}
+
+static int distance(int a, int b) {
+  return abs(node_x[a] - node_x[b]) + abs(node_y[a] - node_y[b]);
+}
+
+int main(int argc, char **argv) {
+  FILE *f;
+  char line[256], *row, *end;
+  int h = 0, n, nodes = 0, a, b, c, x, y, total = 0, split;
+
+  if (argc != 2) {
+    fprintf(stderr, "usage: %s map > subgoal_data.c\n", argv[0]);
+    return 1;
+  }
+  f = fopen(argv[1], "r");
+  if (!f) {
+    perror(argv[1]);
+    return 1;
+  }
+  n = (int)strlen(argv[1]);
+  while (h < SIZE_Y && fgets(line, sizeof(line), f)) {
+    if (n > 2 && !strcmp(argv[1] + n - 2, ".c")) {
+      row = strchr(line, '"');
+      if (!row || !(end = strchr(++row, '"'))) continue;
+      *end = 0;
+    } else {
+      row = line;
+      row[strcspn(row, "\r\n")] = 0;
+      if (!*row) continue;
+    }
+    if ((int)strlen(row) != SIZE_X) {
+      fprintf(stderr, "%s: row %d is %d wide, expected %d\n", argv[1], h + 1, (int)strlen(row), SIZE_X);
+      return 1;
+    }
+    strcpy(map[h++], row);
+  }
+  fclose(f);
+  if (h != SIZE_Y) {
+    fprintf(stderr, "%s: %d rows, expected %d\n", argv[1], h, SIZE_Y);
+    return 1;
+  }
+
+  /* Subgoals, in cell order */
+  for (y = 0; y < SIZE_Y; ++y) {
+    for (x = 0; x < SIZE_X; ++x) {
+      if (!is_subgoal(x, y)) continue;
+      if (nodes == MAX_NODES) {
+        fprintf(stderr, "%s: more than %d subgoals\n", argv[1], MAX_NODES);
+        return 1;
+      }
+      node_x[nodes] = x;
+      node_y[nodes] = y;
+      ++nodes;
+    }
+  }
+  for (a = 0; a < nodes; ++a) h_reach(node_x[a], node_y[a], reach[a]);
+
+  /* Edges between h-reachable subgoals that no other one splits */
+  for (a = 0; a < nodes; ++a) {
+    for (b = a + 1; b < nodes; ++b) {
+      if (!reaches(a, b)) continue;
+      for (split = 0, c = 0; c < nodes && !split; ++c) {
+        split = c != a && c != b && reaches(a, c) && reaches(c, b) &&
+                distance(a, c) + distance(c, b) == distance(a, b);
+      }
+      if (split) continue;
+      edges_of[a][edge_count[a]++] = b;
+      edges_of[b][edge_count[b]++] = a;
+      total += 2;
+    }
+  }
+
+  printf("/* Generated by tools/subgoals.c from %s -- do not edit */\n", argv[1]);
+  printf("#include \"subgoal.h\"\n\n");
+  printf("const uint8_t subgoal_count = %d;\n\n", nodes);
+  printf("const uint8_t subgoal_x[%d] = {", nodes ? nodes : 1);
+  for (a = 0; a < nodes; ++a) printf("%s%d,", (a % 16) ? " " : "\n  ", node_x[a]);
+  printf("\n};\n\n");
+  printf("const uint8_t subgoal_y[%d] = {", nodes ? nodes : 1);
+  for (a = 0; a < nodes; ++a) printf("%s%d,", (a % 16) ? " " : "\n  ", node_y[a]);
+  printf("\n};\n\n");
+  printf("/* Edges of subgoal n: subgoal_edge[subgoal_first[n]..subgoal_first[n + 1]) */\n");
+  printf("const uint16_t subgoal_first[%d] = {", nodes + 1);
+  for (a = 0, c = 0; a <= nodes; ++a) {
+    printf("%s%d,", (a % 12) ? " " : "\n  ", c);
+    if (a < nodes) c += edge_count[a];
+  }
+  printf("\n};\n\n");
+  printf("const uint8_t subgoal_edge[%d] = {", total ? total : 1);
+  for (a = 0, c = 0; a < nodes; ++a) {
+    for (b = 0; b < edge_count[a]; ++b, ++c) {
+      printf("%s%d,", (c % 16) ? " " : "\n  ", edges_of[a][b]);
+    }
+  }
+  printf("\n};\n");
+  fprintf(stderr, "%d subgoals, %d edges\n", nodes, total / 2);
+  return 0;
+}
@@ -0,0 +1,141 @@
+/*
+============================================================
+Telemetry Decoder - Host Tool
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+
+Decodes the solve telemetry ring (telemetry.h) from a dump of the
+cartridge WRAM at $6000-$7FFF, such as an emulator's battery save
+file, and prints the records as CSV, slowest first (frames, then
+work). age 0 is the last solve.
+
+  cc -O2 -o telemetry tools/telemetry.c
+  ./telemetry game.sav > solves.csv
+*/
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Same layout as telemetry.h / wram.h */
+#define WRAM_BASE  0x6000
+#define ADDR       0x6780
+#define BYTES      128
+#define HEADER     8
+#define VERSION    1
+#define RECORD     10
+#define RECORDS    ((BYTES - HEADER) / RECORD)
+
+static const char *solver_name[] = {"astar", "dfs", "idastar", "pathdb", "lrta", "subgoal"};
+
+typedef struct Record {
+  int age;
+  int sx, sy, dx, dy, solver, frames, nodes, work;
+} Record;
+
+static unsigned char area[BYTES];
+static Record rec[RECORDS];
+
+/* Same arithmetic as telemetry.c (end-around carry, mod 255) */
+static int checksum_ok(void) {
+  unsigned sum1 = 0, sum2 = 0;
+  int i;
+  for (i = 0; i < BYTES; ++i) {
+    if (i == 6) i = HEADER;
+    sum1 += area[i];
+    if (sum1 > 0xFF) sum1 = (sum1 + 1) & 0xFF;
+    sum2 += sum1;
+    if (sum2 > 0xFF) sum2 = (sum2 + 1) & 0xFF;
+  }
+  return area[6] == sum1 && area[7] == sum2;
+}
+
+static int slowest_first(const void *a, const void *b) {
+  const Record *ra = a, *rb = b;
+  if (ra->frames != rb->frames) return rb->frames - ra->frames;
+  if (ra->work != rb->work) return rb->work - ra->work;
+  return ra->age - rb->age;
+}
+
+int main(int argc, char **argv) {
+  FILE *f;
+  int next, count, n, i;
+  const unsigned char *r;
+
+  if (argc != 2) {
+    fprintf(stderr, "usage: %s wram.sav > solves.csv\n", argv[0]);
+    return 1;
+  }
+  f = fopen(argv[1], "rb");
+  if (!f) {
+    perror(argv[1]);
+    return 1;
+  }
+  if (fseek(f, ADDR - WRAM_BASE, SEEK_SET) || fread(area, 1, BYTES, f) != BYTES) {
+    fprintf(stderr, "%s: too short for a WRAM dump\n", argv[1]);
+    return 1;
+  }
+  fclose(f);
+
+  if (area[0] != 'T' || area[1] != 'L') {
+    fprintf(stderr, "%s: no telemetry found\n", argv[1]);
+    return 1;
+  }
+  if (area[2] != VERSION || area[3] != RECORD) {
+    fprintf(stderr, "%s: telemetry version %d, record size %d not supported\n",
+            argv[1], area[2], area[3]);
+    return 1;
+  }
+  if (!checksum_ok()) {
+    fprintf(stderr, "%s: bad telemetry checksum\n", argv[1]);
+    return 1;
+  }
+  next = area[4];
+  count = area[5];
+  if (next >= RECORDS || count > RECORDS) {
+    fprintf(stderr, "%s: bad telemetry header\n", argv[1]);
+    return 1;
+  }
+
+  for (n = 0; n < count; ++n) {
+    i = (next - 1 - n + RECORDS) % RECORDS;
+    r = &area[HEADER + i * RECORD];
+    rec[n].age    = n;
+    rec[n].sx     = r[0];
+    rec[n].sy     = r[1];
+    rec[n].dx     = r[2];
+    rec[n].dy     = r[3];
+    rec[n].solver = r[4];
+    rec[n].frames = r[5];
+    rec[n].nodes  = (short)(r[6] | (r[7] << 8));
+    rec[n].work   = r[8] | (r[9] << 8);
+  }
+  qsort(rec, (size_t)count, sizeof(Record), slowest_first);
+
+  printf("age,solver,sx,sy,dx,dy,nodes,work,frames\n");
+  for (n = 0; n < count; ++n) {
+    printf("%d,", rec[n].age);
+    if (rec[n].solver < 6) printf("%s,", solver_name[rec[n].solver]);
+    else printf("%d,", rec[n].solver);
+    printf("%d,%d,%d,%d,%d,%d,%d\n", rec[n].sx, rec[n].sy, rec[n].dx, rec[n].dy,
+           rec[n].nodes, rec[n].work, rec[n].frames);
+  }
+  return 0;
+}
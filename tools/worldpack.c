@@ -0,0 +1,139 @@
+/*
+============================================================
+World Packer - Host Tool
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+
+Converts a text map (one line per tile row, a multiple of
+32 columns by 30 rows) into world_data.c: every screen is
+run-length encoded row by row as (count, tile) pairs and
+packed into 8 KB PRG banks.
+
+  cc -O2 -o worldpack tools/worldpack.c
+  ./worldpack maps/world.txt > world_data.c
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SCREEN_X   32
+#define SCREEN_Y   30
+#define MAX_X      1024
+#define MAX_Y      960
+#define BANK_SIZE  8192
+
+static char map[MAX_Y][MAX_X + 2];
+static unsigned char rle[SCREEN_X * SCREEN_Y * 2];
+static unsigned offset[SCREEN_Y];
+
+int main(int argc, char **argv) {
+  FILE *f;
+  int w = 0, h = 0, sx, sy, s, x, y, n, len, bank = 0, used = 0;
+  int *banks;
+
+  if (argc != 2) {
+    fprintf(stderr, "usage: %s map.txt > world_data.c\n", argv[0]);
+    return 1;
+  }
+  f = fopen(argv[1], "r");
+  if (!f) {
+    perror(argv[1]);
+    return 1;
+  }
+  while (h < MAX_Y && fgets(map[h], sizeof(map[h]), f)) {
+    len = (int)strcspn(map[h], "\r\n");
+    map[h][len] = 0;
+    if (!len) continue;
+    if (w && len != w) {
+      fprintf(stderr, "%s:%d: row is %d wide, expected %d\n", argv[1], h + 1, len, w);
+      return 1;
+    }
+    w = len;
+    ++h;
+  }
+  fclose(f);
+  if (!w || w % SCREEN_X || h % SCREEN_Y) {
+    fprintf(stderr, "%s: %dx%d is not a whole number of %dx%d screens\n",
+            argv[1], w, h, SCREEN_X, SCREEN_Y);
+    return 1;
+  }
+  sx = w / SCREEN_X;
+  sy = h / SCREEN_Y;
+  banks = calloc((size_t)(sx * sy), sizeof(int));
+
+  printf("/* Generated by tools/worldpack.c from %s -- do not edit */\n", argv[1]);
+  printf("#include \"world.h\"\n\n");
+  printf("#ifdef WORLD_MODE\n\n");
+  printf("#if WORLD_SCREENS_X != %d || WORLD_SCREENS_Y != %d\n", sx, sy);
+  printf("#error \"world.h does not match the packed world size\"\n");
+  printf("#endif\n\n");
+  printf("#ifdef WORLD_MMC3\n#pragma rodata-name (push, \"BANK0\")\n#endif\n\n");
+
+  for (s = 0; s < sx * sy; ++s) {
+    /* Encode one screen */
+    n = 0;
+    for (y = 0; y < SCREEN_Y; ++y) {
+      const char *row = &map[(s / sx) * SCREEN_Y + y][(s % sx) * SCREEN_X];
+      offset[y] = (unsigned)n;
+      for (x = 0; x < SCREEN_X; x += len) {
+        for (len = 1; x + len < SCREEN_X && row[x + len] == row[x]; ++len);
+        rle[n++] = (unsigned char)len;
+        rle[n++] = (unsigned char)row[x];
+      }
+    }
+    /* Start a new bank if this screen does not fit */
+    if (used + n > BANK_SIZE) {
+      ++bank;
+      used = 0;
+      printf("#ifdef WORLD_MMC3\n#pragma rodata-name (pop)\n");
+      printf("#pragma rodata-name (push, \"BANK%d\")\n#endif\n\n", bank);
+    }
+    used += n;
+    banks[s] = bank;
+
+    printf("static const byte screen%d[%d] = {", s, n);
+    for (x = 0; x < n; ++x) {
+      printf("%s%d,", (x % 16) ? "" : "\n  ", rle[x]);
+    }
+    printf("\n};\n\n");
+    printf("static const word screen%d_rows[%d] = {", s, SCREEN_Y);
+    for (y = 0; y < SCREEN_Y; ++y) {
+      printf("%s%u,", (y % 10) ? "" : "\n  ", offset[y]);
+    }
+    printf("\n};\n\n");
+  }
+  printf("#ifdef WORLD_MMC3\n#pragma rodata-name (pop)\n#endif\n\n");
+
+  printf("const byte* const world_screen[WORLD_SCREENS] = {\n");
+  for (s = 0; s < sx * sy; ++s) printf("  screen%d,\n", s);
+  printf("};\n\n");
+  printf("const word* const world_screen_rows[WORLD_SCREENS] = {\n");
+  for (s = 0; s < sx * sy; ++s) printf("  screen%d_rows,\n", s);
+  printf("};\n\n");
+  printf("const byte world_screen_bank[WORLD_SCREENS] = {");
+  for (s = 0; s < sx * sy; ++s) printf(" %d,", banks[s]);
+  printf(" };\n\n");
+  printf("#endif // WORLD_MODE\n");
+
+  free(banks);
+  return 0;
+}
@@ -0,0 +1,81 @@
+/*
+============================================================
+Search Visualization - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#include "vis.h"
+#include "grid.h"
+#include "world.h"
+#include "vrambuf.h"
+
+#ifdef SEARCH_VIS
+
+#if (VIS_RING & (VIS_RING - 1)) || VIS_RING > 256
+#error "VIS_RING must be a power of two, up to 256"
+#endif
+
+#define RING_MASK       (VIS_RING - 1)
+
+/* Bytes vrambuf_put_char() needs for a write it cannot merge */
+#define CHAR_BYTES      3
+
+/* Tile painted for each event type */
+static const char vis_tile[3] = {'.', 'o', 'x'};
+
+/* Events: cell low byte, then (type << 4) | cell high bits */
+static uint8_t   ring_lo[VIS_RING];
+static uint8_t   ring_hi[VIS_RING];
+static uint8_t   head, tail;
+
+/* Static variables */
+static uint16_t  cell;
+static uint8_t   x, y;
+
+void __fastcall__ vis_event(uint16_t event) {
+  if (((head + 1) & RING_MASK) == tail) {
+    vis_drain();
+  }
+  ring_lo[head] = (uint8_t)event;
+  ring_hi[head] = (uint8_t)(event >> 8);
+  head = (head + 1) & RING_MASK;
+}
+
+void __fastcall__ vis_drain(void) {
+  while (tail != head && vrambuf_avail() >= CHAR_BYTES) {
+    cell = ring_lo[tail] | ((ring_hi[tail] & 0x0F) << 8);
+    x = GRID_X(cell);
+    y = GRID_Y(cell);
+    vrambuf_put_char(world_ntadr(x + world_origin_x, y + world_origin_y),
+                     vis_tile[ring_hi[tail] >> 4]);
+    tail = (tail + 1) & RING_MASK;
+  }
+  vrambuf_flush();
+}
+
+void __fastcall__ vis_flush(void) {
+  while (tail != head) {
+    vis_drain();
+  }
+}
+
+#endif // SEARCH_VIS
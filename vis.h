@@ -0,0 +1,68 @@
+/*
+============================================================
+Search Visualization - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#ifndef VIS_H
+#define VIS_H
+
+#include "neslib.h"
+#include <inttypes.h>
+
+/*
+  Debug mode: solve_astar() and solve_dfs() report the cells they
+  touch, and the events are painted over the map as the search
+  runs. Defined here, so that the solvers, vis.c and main.c agree;
+  without it vis.c compiles to nothing.
+
+  Events go to a ring buffer. When it fills up, vis_drain() paints
+  as many as fit in one frame's VRAM update buffer and waits for
+  the NMI, so a search slows down to a frame per batch of cells.
+*/
+//#define SEARCH_VIS
+
+/* Ring buffer size in events (power of two, at most 256) */
+#define VIS_RING        64
+
+/* Event types */
+#define VIS_EXPANDED    0   /* A* node closed, DFS cell entered */
+#define VIS_FRONTIER    1   /* A* node pushed on the open set   */
+#define VIS_DEAD_END    2   /* DFS backtracked out of the cell  */
+
+#ifdef SEARCH_VIS
+#define VIS_EVENT(type_, cell_) \
+  vis_event((cell_) | ((uint16_t)(type_) << 12))
+#else
+#define VIS_EVENT(type_, cell_)
+#endif
+
+/* Queues a (type << 12) | cell event, draining if the ring is full */
+void __fastcall__ vis_event(uint16_t event);
+
+/* Paints up to a frame's worth of events, then waits for the NMI */
+void __fastcall__ vis_drain(void);
+
+/* Paints every queued event */
+void __fastcall__ vis_flush(void);
+
+#endif // vis.h
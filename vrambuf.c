@@ -6,6 +6,11 @@
 // index to end of buffer
 byte updptr = 0;
 
+// last entry, remembered so that vrambuf_put_char() can extend it
+static byte lastptr;           // offset of its header
+static byte tailptr = 0xff;    // updptr right after it (0xff = none)
+static word nextadr;           // vram address a run would continue at
+
 // add EOF marker to buffer (but don't increment pointer)
 void vrambuf_end(void) {
   VRAMBUF_SET(NT_UPD_EOF);
@@ -14,6 +19,7 @@ void vrambuf_end(void) {
 // clear vram buffer and place EOF marker
 void vrambuf_clear(void) {
   updptr = 0;
+  tailptr = 0xff;
   vrambuf_end();
 }
 
@@ -29,21 +35,106 @@ void vrambuf_flush(void) {
   vrambuf_clear();
 }
 
-// add multiple characters to update buffer
-// using horizontal increment
-void vrambuf_put(word addr, register const char* str, byte len) {
+// number of data bytes that can still be added this frame
+byte vrambuf_avail(void) {
+  // one byte is always kept for the EOF marker
+  return VBUFSIZE-1-updptr;
+}
+
+// add a run header, flushing first if len bytes won't fit
+static void vrambuf_header(word addr, byte len) {
   // if bytes won't fit, wait for vsync and flush buffer
   if (VBUFSIZE-4-len < updptr) {
     vrambuf_flush();
   }
-  // add vram address
-  VRAMBUF_ADD((addr >> 8) ^ NT_UPD_HORZ);
+  lastptr = updptr;
+  // add vram address and direction
+  if (addr & VRAMBUF_VERT) {
+    VRAMBUF_ADD(((addr >> 8) & 0x3f) | NT_UPD_VERT);
+    nextadr = (addr & 0x3fff) + ((word)len << 5);
+  } else {
+    VRAMBUF_ADD((addr >> 8) | NT_UPD_HORZ);
+    nextadr = addr + len;
+  }
   VRAMBUF_ADD(addr); // only lower 8 bits
   // add length
   VRAMBUF_ADD(len);
+}
+
+// add multiple characters to update buffer
+// using horizontal increment (or vertical, if addr has VRAMBUF_VERT)
+void vrambuf_put(word addr, register const char* str, byte len) {
+  vrambuf_header(addr, len);
   // add data to buffer
   memcpy(updbuf+updptr, str, len);
   updptr += len;
+  tailptr = updptr;
   // place EOF mark
   vrambuf_end();
 }
+
+// add a run of the same character
+void vrambuf_fill(word addr, char ch, byte len) {
+  vrambuf_header(addr, len);
+  // the NMI format has no repeat entry, so expand it here
+  memset(updbuf+updptr, ch, len);
+  updptr += len;
+  tailptr = updptr;
+  vrambuf_end();
+}
+
+// add a single character, merging it into the previous entry
+void vrambuf_put_char(word addr, char ch) {
+  register byte hdr;
+  word prev;
+  // only merge if nothing was added behind our back
+  // and there is room for two more bytes plus EOF
+  if (updptr == tailptr && updptr < VBUFSIZE-2) {
+    hdr = updbuf[lastptr];
+    if (hdr & (NT_UPD_HORZ|NT_UPD_VERT)) {
+      // continue an existing run
+      if (addr == nextadr && updbuf[lastptr+2] != 0xff) {
+        ++updbuf[lastptr+2];
+        nextadr += (hdr & NT_UPD_VERT) ? 32 : 1;
+        goto add_char;
+      }
+    } else {
+      // turn a single write into a run of two
+      prev = ((word)hdr << 8) | updbuf[lastptr+1];
+      if (addr == prev + 1) {
+        hdr |= NT_UPD_HORZ;
+        nextadr = addr + 1;
+      } else if (addr == prev + 32) {
+        hdr |= NT_UPD_VERT;
+        nextadr = addr + 32;
+      } else {
+        goto add_single;
+      }
+      updbuf[lastptr] = hdr;
+      VRAMBUF_ADD(updbuf[lastptr+2]);
+      updbuf[lastptr+2] = 2;
+      goto add_char;
+    }
+  }
+add_single:
+  // single write: MSB, LSB, byte
+  if (VBUFSIZE-4 < updptr) {
+    vrambuf_flush();
+  }
+  lastptr = updptr;
+  VRAMBUF_ADD((addr >> 8) & 0x3f);
+  VRAMBUF_ADD(addr);
+add_char:
+  VRAMBUF_ADD(ch);
+  tailptr = updptr;
+  vrambuf_end();
+}
+
+// like vrambuf_put(), but never waits for a frame
+int vrambuf_try_put(word addr, const char* str, byte len) {
+  if (VBUFSIZE-4-len < updptr) {
+    return -1;
+  }
+  vrambuf_put(addr, str, len);
+  return vrambuf_avail();
+}
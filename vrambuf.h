@@ -1,11 +1,12 @@
-
 #ifndef _VRAMBUF_H
 #define _VRAMBUF_H
 
 #include "neslib.h"
 
-// VBUFSIZE = maximum update buffer bytes
+// VBUFSIZE = maximum update buffer bytes (must be < 256)
+#ifndef VBUFSIZE
 #define VBUFSIZE 128
+#endif
 
 // update buffer starts at $100 (stack page)
 #define updbuf ((byte*)0x100)
@@ -36,8 +37,28 @@ void vrambuf_clear(void);
 // this assumes the NMI will call flush_vram_update()
 void vrambuf_flush(void);
 
+// number of data bytes that can still be added this frame
+byte vrambuf_avail(void);
+
 // add multiple characters to update buffer
-// using horizontal increment
+// using horizontal increment (or vertical, if addr has VRAMBUF_VERT)
 void vrambuf_put(word addr, const char* str, byte len);
 
+// same as vrambuf_put(), using vertical increment
+#define vrambuf_put_vert(addr,str,len) \
+  vrambuf_put((addr) | VRAMBUF_VERT, str, len)
+
+// add a run of the same character
+// (horizontal, or vertical if addr has VRAMBUF_VERT)
+void vrambuf_fill(word addr, char ch, byte len);
+
+// add a single character, merging it into the previous entry
+// when it continues that entry horizontally or vertically
+void vrambuf_put_char(word addr, char ch);
+
+// like vrambuf_put(), but never waits for a frame:
+// returns the bytes left after the put, or -1 if it did not fit
+// (in which case nothing is added)
+int vrambuf_try_put(word addr, const char* str, byte len);
+
 #endif // vrambuf.h
@@ -0,0 +1,221 @@
+/*
+============================================================
+Scrolling World - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#include "world.h"
+#include "vrambuf.h"
+#include "swamp.h"
+#include "wram.h"
+
+#define SCREEN_X        WORLD_SCREEN_X
+#define SCREEN_Y        WORLD_SCREEN_Y
+#define CAMERA_MAX_X    (WORLD_SIZE_X * 8 - 256)
+#define CAMERA_MAX_Y    (WORLD_SIZE_Y * 8 - 240)
+#define CAMERA_STEP     8
+
+#ifdef WORLD_MMC3
+#define MMC3_BANK_SELECT  (*(volatile byte*)0x8000)
+#define MMC3_BANK_DATA    (*(volatile byte*)0x8001)
+#define MMC3_PRG_8000     6  /* R6: 8 KB bank at $8000 */
+#endif
+
+Camera   camera;
+uint16_t world_origin_x;
+uint16_t world_origin_y;
+
+#ifdef WORLD_MODE
+
+/* Two decoded screen rows side by side */
+static char      wide[SCREEN_X * 2];
+
+static const byte* src;
+static uint8_t   screen;
+static uint8_t   row;
+static uint8_t   n, len, col;
+static uint16_t  tx, ty;
+static uint16_t  last_tx, last_ty;
+static uint16_t  lo, hi;
+static word      addr;
+
+#ifdef WORLD_MMC3
+static uint8_t   bank = 0xFF;
+#endif
+
+/* Points src at a screen row, swapping its bank in */
+static void seek_row(uint16_t wx, uint16_t wy) {
+  row = (uint8_t)(wy % SCREEN_Y);
+  screen = (uint8_t)((wy / SCREEN_Y) * WORLD_SCREENS_X + (wx >> 5));
+#ifdef WORLD_MMC3
+  if (world_screen_bank[screen] != bank) {
+    bank = world_screen_bank[screen];
+    MMC3_BANK_SELECT = MMC3_PRG_8000;
+    MMC3_BANK_DATA = WORLD_FIRST_BANK + bank;
+  }
+#endif
+  src = world_screen[screen] + world_screen_rows[screen][row];
+}
+
+/* Decodes a screen row into dst[0..31] */
+static void decode_row(char* dst) {
+  for (n = 0; n < SCREEN_X; n += len) {
+    len = src[0];
+    for (col = 0; col < len; ++col) {
+      dst[n + col] = src[1];
+    }
+    src += 2;
+  }
+}
+
+/* Decodes world row wy from column wx & ~31, 64 tiles wide.
+   Returns the tiles from wx on (at least 33 of them) */
+static char* read_row(uint16_t wx, uint16_t wy) {
+  seek_row(wx, wy);
+  decode_row(wide);
+  if ((wx >> 5) + 1 < WORLD_SCREENS_X) {
+    seek_row(wx + SCREEN_X, wy);
+    decode_row(wide + SCREEN_X);
+  } else {
+    for (n = SCREEN_X; n < sizeof(wide); ++n) wide[n] = 'X';
+  }
+  return wide + (wx & 31);
+}
+
+char __fastcall__ world_tile(uint16_t wx, uint16_t wy) {
+  seek_row(wx, wy);
+  col = wx & 31;
+  while (col >= src[0]) {
+    col -= src[0];
+    src += 2;
+  }
+  return src[1];
+}
+
+word __fastcall__ world_ntadr(uint16_t wx, uint16_t wy) {
+  return ((wx & 32) ? NAMETABLE_B : NAMETABLE_A)
+       | ((wy % SCREEN_Y) << 5) | (wx & 31);
+}
+
+void __fastcall__ world_follow(uint16_t px, uint16_t py) {
+  /* Target: (px, py) in the middle of the screen, clamped */
+  tx = (px > 128) ? px - 128 : 0;
+  if (tx > CAMERA_MAX_X) tx = CAMERA_MAX_X;
+  ty = (py > 120) ? py - 120 : 0;
+  if (ty > CAMERA_MAX_Y) ty = CAMERA_MAX_Y;
+
+  if (tx > camera.x) camera.x += MIN(tx - camera.x, CAMERA_STEP);
+  else               camera.x -= MIN(camera.x - tx, CAMERA_STEP);
+  if (ty > camera.y) camera.y += MIN(ty - camera.y, CAMERA_STEP);
+  else               camera.y -= MIN(camera.y - ty, CAMERA_STEP);
+}
+
+void __fastcall__ world_draw(void) {
+  char* tiles;
+  uint8_t y;
+
+  last_tx = camera.x >> 3;
+  last_ty = camera.y >> 3;
+  for (y = 0; y < SCREEN_Y; ++y) {
+    tiles = read_row(last_tx, last_ty + y);
+    /* 33 columns, split where they cross into the other nametable */
+    for (n = 0; n <= SCREEN_X; n += len) {
+      tx = last_tx + n;
+      len = SCREEN_X - (tx & 31);
+      if (n + len > SCREEN_X + 1) len = SCREEN_X + 1 - n;
+      if (tx >= WORLD_SIZE_X) break;
+      vram_adr(world_ntadr(tx, last_ty + y));
+      vram_write((const byte*)tiles + n, len);
+    }
+  }
+  scroll(camera.x & 511, camera.y % 240);
+}
+
+/* Column wx, rows on screen: one vertical run (two when it wraps) */
+static void stream_column(uint16_t wx) {
+  if (wx >= WORLD_SIZE_X) return;
+  for (n = 0; n < SCREEN_Y; ++n) {
+    ty = last_ty + n;
+    vrambuf_put_char(world_ntadr(wx, ty), world_tile(wx, ty));
+  }
+}
+
+/* Row wy, columns on screen: merged into horizontal runs */
+static void stream_row(uint16_t wy) {
+  char* tiles;
+  uint8_t i;
+  if (wy >= WORLD_SIZE_Y) return;
+  tiles = read_row(last_tx, wy);
+  for (i = 0; i <= SCREEN_X; ++i) {
+    tx = last_tx + i;
+    if (tx >= WORLD_SIZE_X) break;
+    vrambuf_put_char(world_ntadr(tx, wy), tiles[i]);
+  }
+}
+
+void __fastcall__ world_scroll(void) {
+  tx = camera.x >> 3;
+  ty = camera.y >> 3;
+  if (tx != last_tx) {
+    lo = (tx > last_tx) ? tx + SCREEN_X : tx;
+    last_tx = tx;
+    stream_column(lo);
+  }
+  if (ty != last_ty) {
+    lo = (ty > last_ty) ? ty + SCREEN_Y - 1 : ty;
+    last_ty = ty;
+    stream_row(lo);
+  }
+  scroll(camera.x & 511, camera.y % 240);
+}
+
+/* Origin of a window covering [a..b], centered and clamped */
+static uint16_t window_origin(uint16_t a, uint16_t b, uint8_t size, uint16_t limit) {
+  lo = MIN(a, b);
+  hi = MAX(a, b);
+  if (hi - lo >= size) return 0xFFFF;
+  hi = (size - 1 - (hi - lo)) / 2;
+  lo = (lo > hi) ? lo - hi : 0;
+  return MIN(lo, limit - size);
+}
+
+uint8_t __fastcall__ world_window(uint16_t sx, uint16_t sy, uint16_t dx, uint16_t dy) {
+  uint8_t y;
+  uint16_t ox, oy;
+
+  ox = window_origin(sx, dx, GRID_SIZE_X, WORLD_SIZE_X);
+  oy = window_origin(sy, dy, GRID_SIZE_Y, WORLD_SIZE_Y);
+  if (ox == 0xFFFF || oy == 0xFFFF) return WORLD_OUT_OF_RANGE;
+
+  /* What LRTA* learned belongs to the cells of the last window */
+  if (ox != world_origin_x || oy != world_origin_y) wram_owner = WRAM_OWNER_NONE;
+  world_origin_x = ox;
+  world_origin_y = oy;
+  for (y = 0; y < GRID_SIZE_Y; ++y) {
+    grid_set_row(y, read_row(ox, oy + y));
+  }
+  /* Swamps found on the previous grid no longer apply */
+  swamp_clear();
+  return WORLD_OK;
+}
+
+#endif // WORLD_MODE
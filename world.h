@@ -0,0 +1,119 @@
+/*
+============================================================
+Scrolling World - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#ifndef WORLD_H
+#define WORLD_H
+
+#include "neslib.h"
+#include "grid.h"
+#include <inttypes.h>
+
+/*
+  Scrolling world: the screen scrolls over a grid of 32x30 screens
+  packed by tools/worldpack.c into world_data.c. Every screen row is
+  run-length encoded, so rows and columns can be streamed into the
+  nametables while scrolling.
+
+  This is a display mode, not a bigger search: the solvers still
+  search their grid (see grid.h), no wider than a screen, and
+  world_window() loads the window of the world around a query into
+  it. Nothing plans across windows: a path that has to leave the
+  window is not found, and ends a window or more apart are refused.
+
+  WORLD_MODE is set here rather than in main.c, so that world.c and
+  world_data.c see it too. Without it they compile to nothing but
+  the camera and the window origin, both left at 0, and the map is
+  the single screen of area.
+
+  With WORLD_MMC3 defined (in world.h, so that world.c and
+  world_data.c agree), screens are placed in segments BANK0, BANK1...
+  which the linker config must map to 8 KB PRG banks; world.c swaps
+  them into $8000-$9FFF before reading. Without it, everything stays
+  in fixed ROM.
+*/
+//#define WORLD_MODE
+//#define WORLD_MMC3
+#define WORLD_FIRST_BANK   0
+
+#define WORLD_SCREENS_X    2
+#define WORLD_SCREENS_Y    2
+#define WORLD_SCREENS      (WORLD_SCREENS_X * WORLD_SCREENS_Y)
+#define WORLD_SCREEN_X     32  /* tiles (keep in sync with tools/worldpack.c) */
+#define WORLD_SCREEN_Y     30
+#define WORLD_SIZE_X       (WORLD_SCREEN_X * WORLD_SCREENS_X)  /* tiles */
+#define WORLD_SIZE_Y       (WORLD_SCREEN_Y * WORLD_SCREENS_Y)
+
+typedef struct Camera {
+  uint16_t x;  /* pixels */
+  uint16_t y;
+} Camera;
+
+extern Camera camera;
+
+/* World position of the solver window (cell 0,0 of the grid) */
+extern uint16_t world_origin_x;
+extern uint16_t world_origin_y;
+
+#ifdef WORLD_MODE
+
+/* Packed world (world_data.c) */
+extern const byte* const world_screen[WORLD_SCREENS];
+extern const word* const world_screen_rows[WORLD_SCREENS];
+extern const byte        world_screen_bank[WORLD_SCREENS];
+
+/* Tile at a world position */
+char __fastcall__ world_tile(uint16_t tx, uint16_t ty);
+
+/* Nametable address of a world position (vertical mirroring) */
+word __fastcall__ world_ntadr(uint16_t tx, uint16_t ty);
+
+/* Moves the camera up to 8 pixels toward centering (px, py) */
+void __fastcall__ world_follow(uint16_t px, uint16_t py);
+
+/* Draws the screen at the camera, rendering must be off */
+void __fastcall__ world_draw(void);
+
+/* Streams the column/row the camera moved into, through vrambuf,
+   and sets the scroll. Call once per frame after moving the camera */
+void __fastcall__ world_scroll(void);
+
+/* world_window() results */
+#define WORLD_OK            0
+#define WORLD_OUT_OF_RANGE  1   /* The points do not fit in one window */
+
+/* Loads a window holding both points into the solver grid and sets
+   world_origin_x/y. Returns WORLD_OUT_OF_RANGE, with the grid left
+   as it was, if they are a window or more apart. The solvers only
+   see the window: a path that has to leave it is not found */
+uint8_t __fastcall__ world_window(uint16_t sx, uint16_t sy, uint16_t dx, uint16_t dy);
+
+#else
+
+/* The world is area, on the first nametable */
+#define world_ntadr(tx_, ty_) NTADR_A(tx_, ty_)
+
+#endif // WORLD_MODE
+
+#endif // world.h
@@ -0,0 +1,178 @@
+/* Generated by tools/worldpack.c from maps/world.txt -- do not edit */
+#include "world.h"
+
+#ifdef WORLD_MODE
+
+#if WORLD_SCREENS_X != 2 || WORLD_SCREENS_Y != 2
+#error "world.h does not match the packed world size"
+#endif
+
+#ifdef WORLD_MMC3
+#pragma rodata-name (push, "BANK0")
+#endif
+
+static const byte screen0[420] = {
+  32,88,1,88,30,32,1,88,1,88,16,32,1,88,10,32,
+  1,88,2,32,1,88,1,88,16,32,1,88,1,32,2,88,
+  2,32,2,88,1,32,4,88,1,32,1,88,1,88,5,32,
+  5,88,6,32,1,88,13,32,1,88,1,88,10,32,1,88,
+  5,32,1,88,3,32,1,88,6,32,1,88,2,32,1,88,
+  1,88,1,32,1,88,9,32,3,88,2,32,2,88,3,32,
+  5,88,4,32,1,88,1,88,2,32,1,88,10,32,13,88,
+  4,32,1,88,1,88,3,32,1,88,27,32,1,88,14,32,
+  1,88,16,32,1,88,11,32,3,88,1,32,1,88,2,32,
+  1,88,11,32,1,88,1,88,1,32,2,88,22,32,4,88,
+  1,32,1,88,1,88,9,32,1,88,10,32,1,88,3,32,
+  1,88,5,32,1,88,1,88,7,32,1,88,4,32,1,88,
+  3,32,1,88,4,32,4,88,5,32,1,88,1,88,2,32,
+  2,88,1,32,4,88,10,32,1,88,10,32,1,88,1,88,
+  7,32,1,88,22,32,1,88,1,88,8,32,1,88,5,32,
+  4,88,3,32,1,88,1,32,3,88,4,32,1,88,1,88,
+  5,32,1,88,6,32,1,88,8,32,1,88,1,32,2,88,
+  5,32,1,88,1,88,9,32,2,88,9,32,2,88,2,32,
+  1,88,5,32,1,88,1,88,1,32,26,88,3,32,1,88,
+  1,88,30,32,1,88,1,88,3,32,26,88,1,32,1,88,
+  1,88,30,32,1,88,1,88,17,32,1,88,5,32,3,88,
+  4,32,1,88,1,88,1,32,1,88,14,32,1,88,1,32,
+  1,88,4,32,1,88,1,32,1,88,4,32,1,88,1,88,
+  3,32,1,88,6,32,4,88,3,32,1,88,5,32,3,88,
+  4,32,1,88,1,88,3,32,1,88,3,32,1,88,22,32,
+  1,88,1,88,30,32,1,88,1,88,30,32,1,88,5,88,
+  2,32,25,88,
+};
+
+static const word screen0_rows[30] = {
+  0,2,8,22,44,58,80,102,116,124,
+  132,150,164,182,204,222,232,254,276,294,
+  304,310,320,326,340,366,388,402,408,414,
+};
+
+static const byte screen1[424] = {
+  32,88,1,88,30,32,1,88,1,88,2,32,1,88,10,32,
+  1,88,16,32,1,88,1,88,1,32,4,88,1,32,2,88,
+  2,32,2,88,1,32,1,88,16,32,1,88,1,88,13,32,
+  1,88,6,32,5,88,5,32,1,88,1,88,2,32,1,88,
+  6,32,1,88,3,32,1,88,5,32,1,88,10,32,1,88,
+  1,88,4,32,5,88,3,32,2,88,2,32,3,88,9,32,
+  1,88,1,32,1,88,1,88,4,32,13,88,10,32,1,88,
+  2,32,1,88,27,32,1,88,3,32,1,88,16,32,1,88,
+  14,32,1,88,1,88,11,32,1,88,2,32,1,88,1,32,
+  3,88,11,32,1,88,1,88,1,32,4,88,22,32,2,88,
+  1,32,1,88,1,88,5,32,1,88,3,32,1,88,10,32,
+  1,88,9,32,1,88,1,88,5,32,4,88,4,32,1,88,
+  3,32,1,88,4,32,1,88,7,32,1,88,1,88,10,32,
+  1,88,10,32,4,88,1,32,2,88,2,32,1,88,1,88,
+  22,32,1,88,7,32,1,88,1,88,4,32,3,88,1,32,
+  1,88,3,32,4,88,5,32,1,88,8,32,1,88,1,88,
+  5,32,2,88,1,32,1,88,8,32,1,88,6,32,1,88,
+  5,32,1,88,1,88,5,32,1,88,2,32,2,88,9,32,
+  2,88,9,32,1,88,1,88,3,32,26,88,1,32,1,88,
+  1,88,30,32,1,88,1,88,1,32,26,88,3,32,1,88,
+  1,88,30,32,1,88,1,88,4,32,3,88,5,32,1,88,
+  17,32,1,88,1,88,4,32,1,88,1,32,1,88,4,32,
+  1,88,1,32,1,88,14,32,1,88,1,32,1,88,1,88,
+  4,32,3,88,5,32,1,88,3,32,4,88,6,32,1,88,
+  3,32,1,88,1,88,22,32,1,88,3,32,1,88,3,32,
+  1,88,1,88,30,32,1,88,1,88,30,32,1,88,8,88,
+  1,32,17,88,1,32,5,88,
+};
+
+static const word screen1_rows[30] = {
+  0,2,8,22,44,58,80,102,116,124,
+  132,150,164,182,204,222,232,254,276,294,
+  304,310,320,326,340,366,388,402,408,414,
+};
+
+static const byte screen2[418] = {
+  5,88,2,32,25,88,1,88,30,32,1,88,1,88,30,32,
+  1,88,1,88,3,32,1,88,3,32,1,88,22,32,1,88,
+  1,88,3,32,1,88,6,32,4,88,3,32,1,88,5,32,
+  3,88,4,32,1,88,1,88,1,32,1,88,14,32,1,88,
+  1,32,1,88,4,32,1,88,1,32,1,88,4,32,1,88,
+  1,88,17,32,1,88,5,32,3,88,4,32,1,88,1,88,
+  30,32,1,88,1,88,3,32,26,88,2,32,1,88,31,32,
+  1,88,1,32,26,88,3,32,1,88,1,88,9,32,2,88,
+  9,32,2,88,2,32,1,88,5,32,1,88,1,88,5,32,
+  1,88,6,32,1,88,8,32,1,88,1,32,2,88,5,32,
+  1,88,1,88,8,32,1,88,5,32,4,88,3,32,1,88,
+  1,32,3,88,4,32,1,88,1,88,7,32,1,88,22,32,
+  1,88,1,88,2,32,2,88,1,32,4,88,10,32,1,88,
+  10,32,1,88,1,88,7,32,1,88,4,32,1,88,3,32,
+  1,88,4,32,4,88,5,32,1,88,1,88,9,32,1,88,
+  10,32,1,88,3,32,1,88,5,32,1,88,1,88,1,32,
+  2,88,22,32,4,88,1,32,1,88,1,88,11,32,3,88,
+  1,32,1,88,2,32,1,88,11,32,1,88,1,88,14,32,
+  1,88,16,32,1,88,3,32,1,88,26,32,1,88,1,88,
+  2,32,1,88,10,32,13,88,4,32,1,88,1,88,1,32,
+  1,88,9,32,3,88,2,32,2,88,3,32,5,88,4,32,
+  1,88,1,88,10,32,1,88,5,32,1,88,3,32,1,88,
+  6,32,1,88,2,32,1,88,1,88,5,32,5,88,6,32,
+  1,88,13,32,1,88,1,88,16,32,1,88,1,32,2,88,
+  2,32,2,88,1,32,4,88,1,32,1,88,1,88,16,32,
+  1,88,10,32,1,88,2,32,1,88,1,88,30,32,1,88,
+  32,88,
+};
+
+static const word screen2_rows[30] = {
+  0,6,12,18,32,54,80,94,100,108,
+  112,122,140,162,184,194,212,234,252,266,
+  284,292,302,316,338,360,374,396,410,416,
+};
+
+static const byte screen3[422] = {
+  8,88,1,32,17,88,1,32,5,88,1,88,30,32,1,88,
+  1,88,30,32,1,88,1,88,22,32,1,88,3,32,1,88,
+  3,32,1,88,1,88,4,32,3,88,5,32,1,88,3,32,
+  4,88,6,32,1,88,3,32,1,88,1,88,4,32,1,88,
+  1,32,1,88,4,32,1,88,1,32,1,88,14,32,1,88,
+  1,32,1,88,1,88,4,32,3,88,5,32,1,88,17,32,
+  1,88,1,88,30,32,1,88,2,32,26,88,3,32,1,88,
+  31,32,1,88,1,88,3,32,26,88,1,32,1,88,1,88,
+  5,32,1,88,2,32,2,88,9,32,2,88,9,32,1,88,
+  1,88,5,32,2,88,1,32,1,88,8,32,1,88,6,32,
+  1,88,5,32,1,88,1,88,4,32,3,88,1,32,1,88,
+  3,32,4,88,5,32,1,88,8,32,1,88,1,88,22,32,
+  1,88,7,32,1,88,1,88,10,32,1,88,10,32,4,88,
+  1,32,2,88,2,32,1,88,1,88,5,32,4,88,4,32,
+  1,88,3,32,1,88,4,32,1,88,7,32,1,88,1,88,
+  5,32,1,88,3,32,1,88,10,32,1,88,9,32,1,88,
+  1,88,1,32,4,88,22,32,2,88,1,32,1,88,1,88,
+  11,32,1,88,2,32,1,88,1,32,3,88,11,32,1,88,
+  16,32,1,88,14,32,1,88,1,88,26,32,1,88,3,32,
+  1,88,1,88,4,32,13,88,10,32,1,88,2,32,1,88,
+  1,88,4,32,5,88,3,32,2,88,2,32,3,88,9,32,
+  1,88,1,32,1,88,1,88,2,32,1,88,6,32,1,88,
+  3,32,1,88,5,32,1,88,10,32,1,88,1,88,13,32,
+  1,88,6,32,5,88,5,32,1,88,1,88,1,32,4,88,
+  1,32,2,88,2,32,2,88,1,32,1,88,16,32,1,88,
+  1,88,2,32,1,88,10,32,1,88,16,32,1,88,1,88,
+  30,32,1,88,32,88,
+};
+
+static const word screen3_rows[30] = {
+  0,10,16,22,36,58,84,98,104,112,
+  116,126,144,166,188,198,216,238,256,270,
+  288,296,306,320,342,364,378,400,414,420,
+};
+
+#ifdef WORLD_MMC3
+#pragma rodata-name (pop)
+#endif
+
+const byte* const world_screen[WORLD_SCREENS] = {
+  screen0,
+  screen1,
+  screen2,
+  screen3,
+};
+
+const word* const world_screen_rows[WORLD_SCREENS] = {
+  screen0_rows,
+  screen1_rows,
+  screen2_rows,
+  screen3_rows,
+};
+
+const byte world_screen_bank[WORLD_SCREENS] = { 0, 0, 0, 0, };
+
+#endif // WORLD_MODE
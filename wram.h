@@ -0,0 +1,146 @@
+/*
+============================================================
+WRAM Layout - NES Implementation
+Copyright 2018 - 2026 Ninja Dynamics - See license below
+============================================================
+Creative Commons - Attribution 3.0 Unported
+https://creativecommons.org/licenses/by/3.0/legalcode
+You are free to:
+------------------------------------------------------------
+    Share - copy and redistribute the material in any
+    medium or format.
+    Adapt - remix, transform, and build upon the material
+    for any purpose, even commercially.
+Under the following terms:
+------------------------------------------------------------
+    Attribution - You must give appropriate credit,
+    provide a link to the license, and indicate if
+    changes were made. You may do so in any reasonable
+    manner, but not in any way that suggests the licensor
+    endorses you or your use.
+    No additional restrictions -- You may not apply legal
+    terms or technological measures that legally restrict
+    others from doing anything the license permits.
+============================================================
+*/
+#ifndef WRAM_H
+#define WRAM_H
+
+#include "grid.h"
+#include <inttypes.h>
+
+/*
+  Cartridge WRAM ($6000-$7FFF) layout, shared by the solvers.
+  The arrays are reached through plain (non-volatile) casts so
+  that cc65 can keep values in registers and fold indexing;
+  nothing else writes WRAM behind the solvers' back.
+
+  $6000-$677F  DFS stack, unless packed        (dfs.c)
+  $6000-$677F  nearest-target queue            (nearest.c)
+  $6000-$63FF  A* open set heap, split tables  (astar.c)
+                 (ASTAR_COMPACT: first 128 bytes of each page)
+  $6000-$6677  subgoal graph search            (subgoal.c)
+  $6780-$67FF  solve telemetry ring            (telemetry.c)
+  $6800-$6BBF  waypointX
+  $6BC0-$6BFF  swamp flood stack, x            (swamp.c)
+  $6C00-$6FBF  waypointY
+  $6FC0-$6FFF  swamp flood stack, y            (swamp.c)
+  $7000-$7FBF  A* g and parent, split tables   (astar.c)
+  $7000-$759F  A* g and parent, ASTAR_COMPACT  (astar.c)
+  $7000-$73BF  nearest-target step directions  (nearest.c)
+  $7000-$77BF  LRTA* learned h, split tables   (lrta.c, kept)
+  $7FC0-$7FFF  benchmark results               (bench.c)
+
+  The solvers never run at the same time, so their areas overlap.
+  The telemetry ring is never borrowed: on battery-backed carts it
+  outlives resets and power cycles. Neither are the benchmark
+  results, so they can be dumped at any time.
+  swamp_analyze() runs between searches and borrows $6000-$63BF
+  and $7000-$7FBF for its depth-first numbering.
+  The LRTA* table is the one thing kept in $7000-$7FBF between
+  calls, and A*, solve_nearest() and swamp_analyze() all write over
+  it. Whoever last filled that range is in wram_owner: lrta_begin()
+  starts learning over unless it is still WRAM_OWNER_LRTA.
+*/
+#ifdef __CC65__
+#define WRAM_ARRAY(type_, count_, addr_) \
+  (*(type_ (*)[count_])(addr_))
+#else
+/* Host builds: one WRAM image per thread, defined in grid.c */
+#define WRAM_BASE       0x6000
+#define WRAM_SIZE       0x2000
+extern SOLVER_LOCAL uint8_t wram[WRAM_SIZE];
+#define WRAM_ARRAY(type_, count_, addr_) \
+  (*(type_ (*)[count_])(wram + ((addr_) - WRAM_BASE)))
+#endif
+
+/* Last user of $7000-$7FBF (see above) */
+#define WRAM_OWNER_NONE     0   /* Nothing kept, or the grid changed */
+#define WRAM_OWNER_ASTAR    1
+#define WRAM_OWNER_NEAREST  2
+#define WRAM_OWNER_SWAMP    3
+#define WRAM_OWNER_LRTA     4
+
+extern SOLVER_LOCAL uint8_t wram_owner;
+
+/* One entry per cell. Areas are laid out for the largest grid (960) */
+#define WAYPOINT_COUNT  GRID_CELLS
+
+#define waypointX       WRAM_ARRAY(uint8_t,  WAYPOINT_COUNT, 0x6800)
+#define waypointY       WRAM_ARRAY(uint8_t,  WAYPOINT_COUNT, 0x6C00)
+
+/* DFS */
+#define dfs_stack       WRAM_ARRAY(uint16_t, WAYPOINT_COUNT, 0x6000)
+
+/* A* */
+#define heap_node_lo    WRAM_ARRAY(uint8_t,  256, 0x6000)
+#define heap_node_hi    WRAM_ARRAY(uint8_t,  256, 0x6100)
+#define heap_key_lo     WRAM_ARRAY(uint8_t,  256, 0x6200)
+#define heap_key_hi     WRAM_ARRAY(uint8_t,  256, 0x6300)
+#define g_lo            WRAM_ARRAY(uint8_t,  WAYPOINT_COUNT, 0x7000)
+#define g_hi            WRAM_ARRAY(uint8_t,  WAYPOINT_COUNT, 0x7400)
+#define parent_lo       WRAM_ARRAY(uint8_t,  WAYPOINT_COUNT, 0x7800)
+#define parent_hi       WRAM_ARRAY(uint8_t,  WAYPOINT_COUNT, 0x7C00)
+
+/* Compact A* (ASTAR_COMPACT): g_lo, then 2-bit fields, 4 cells per byte */
+#define g_top           WRAM_ARRAY(uint8_t,  WAYPOINT_COUNT / 4, 0x73C0)
+#define parent_dir      WRAM_ARRAY(uint8_t,  WAYPOINT_COUNT / 4, 0x74B0)
+
+/* Nearest target (breadth-first) */
+#define nearest_queue   WRAM_ARRAY(uint16_t, WAYPOINT_COUNT, 0x6000)
+#define nearest_from    WRAM_ARRAY(uint8_t,  WAYPOINT_COUNT, 0x7000)
+
+/* Subgoal graph search: per node f, parent and heap slot, then cell bitmaps */
+#define subgoal_f_lo    WRAM_ARRAY(uint8_t,  256, 0x6000)
+#define subgoal_f_hi    WRAM_ARRAY(uint8_t,  256, 0x6100)
+#define subgoal_parent  WRAM_ARRAY(uint8_t,  256, 0x6200)
+#define subgoal_heap    WRAM_ARRAY(uint8_t,  256, 0x6300)
+#define subgoal_slot    WRAM_ARRAY(uint8_t,  256, 0x6400)
+#define subgoal_from_s  WRAM_ARRAY(uint8_t,  GRID_BYTES, 0x6500)
+#define subgoal_from_g  WRAM_ARRAY(uint8_t,  GRID_BYTES, 0x6580)
+#define subgoal_segment WRAM_ARRAY(uint8_t,  GRID_BYTES, 0x6600)
+
+/* LRTA* (kept between moves, see lrta.h) */
+#define lrta_h_lo       WRAM_ARRAY(uint8_t,  WAYPOINT_COUNT, 0x7000)
+#define lrta_h_hi       WRAM_ARRAY(uint8_t,  WAYPOINT_COUNT, 0x7400)
+
+/* Telemetry (see telemetry.h, keep in sync with tools/telemetry.c) */
+#define TELEMETRY_ADDR  0x6780
+#define TELEMETRY_BYTES 128
+#define telemetry_wram  WRAM_ARRAY(uint8_t,  TELEMETRY_BYTES, TELEMETRY_ADDR)
+
+/* Benchmark (see bench.h, keep in sync with tools/bench.c) */
+#define BENCH_ADDR      0x7FC0
+#define BENCH_BYTES     64
+#define bench_wram      WRAM_ARRAY(uint8_t,  BENCH_BYTES, BENCH_ADDR)
+
+/* Swamp analysis (between searches only) */
+#define swamp_state     WRAM_ARRAY(uint8_t,  WAYPOINT_COUNT, 0x6000)
+#define swamp_disc_lo   WRAM_ARRAY(uint8_t,  WAYPOINT_COUNT, 0x7000)
+#define swamp_disc_hi   WRAM_ARRAY(uint8_t,  WAYPOINT_COUNT, 0x7400)
+#define swamp_low_lo    WRAM_ARRAY(uint8_t,  WAYPOINT_COUNT, 0x7800)
+#define swamp_low_hi    WRAM_ARRAY(uint8_t,  WAYPOINT_COUNT, 0x7C00)
+#define swamp_stack_x   WRAM_ARRAY(uint8_t,  64, 0x6BC0)
+#define swamp_stack_y   WRAM_ARRAY(uint8_t,  64, 0x6FC0)
+
+#endif // wram.h